@@ -6,6 +6,8 @@
 
 #include "activeconnectiontest.h"
 
+#include "activationtracer.h"
+#include "batchactivation.h"
 #include "device.h"
 #include "manager.h"
 #include "settings.h"
@@ -16,37 +18,18 @@
 #include "fakenetwork/settings.h"
 #include "fakenetwork/wireddevice.h"
 
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QSignalSpy>
 #include <QTest>
 
-void ActiveConnectionTest::initTestCase()
+static NetworkManager::ConnectionSettings::Ptr wiredConnectionSettings(const QString &id, const QString &uuid)
 {
-    fakeNetwork = new FakeNetwork();
-
-    WiredDevice *device = new WiredDevice();
-    /* Device properties */
-    device->setAutoconnect(true);
-    device->setCapabilities(3);
-    device->setDeviceType(1);
-    device->setDriver(QLatin1String("e1000e"));
-    device->setDriverVersion(QLatin1String("2.3.2-k"));
-    device->setFirmwareMissing(false);
-    device->setFirmwareVersion(QLatin1String("0.13-3"));
-    device->setInterface(QLatin1String("em1"));
-    device->setManaged(true);
-    device->setUdi(QLatin1String("/sys/devices/pci0000:00/0000:00:19.0/net/em1"));
-
-    /* Wired device properties */
-    device->setCarrier(true);
-    device->setHwAddress(QLatin1String("F0:DE:F1:FB:30:C1"));
-    device->setPermanentHwAddress(QLatin1String("F0:DE:F1:FB:30:C1"));
-
-    fakeNetwork->addDevice(device);
-
     NetworkManager::ConnectionSettings::Ptr connectionSettings =
         NetworkManager::ConnectionSettings::Ptr(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
-    connectionSettings->setId("Wired connection");
-    connectionSettings->setUuid(QLatin1String("39af79a5-b053-4893-9378-7342a5a30d06"));
+    connectionSettings->setId(id);
+    connectionSettings->setUuid(uuid);
     NetworkManager::Ipv4Setting::Ptr ipv4Setting = connectionSettings->setting(NetworkManager::Setting::Ipv4).dynamicCast<NetworkManager::Ipv4Setting>();
     ipv4Setting->setInitialized(true);
     ipv4Setting->setMethod(NetworkManager::Ipv4Setting::Automatic);
@@ -57,6 +40,35 @@ void ActiveConnectionTest::initTestCase()
     wiredSetting->setInitialized(true);
     // Something needs to be set to not use default values, when using default values we get an empty map
     wiredSetting->setSpeed(100);
+    return connectionSettings;
+}
+
+void ActiveConnectionTest::initTestCase()
+{
+    fakeNetwork = new FakeNetwork();
+
+    fakeDevice = new WiredDevice();
+    /* Device properties */
+    fakeDevice->setAutoconnect(true);
+    fakeDevice->setCapabilities(3);
+    fakeDevice->setDeviceType(1);
+    fakeDevice->setDriver(QLatin1String("e1000e"));
+    fakeDevice->setDriverVersion(QLatin1String("2.3.2-k"));
+    fakeDevice->setFirmwareMissing(false);
+    fakeDevice->setFirmwareVersion(QLatin1String("0.13-3"));
+    fakeDevice->setInterface(QLatin1String("em1"));
+    fakeDevice->setManaged(true);
+    fakeDevice->setUdi(QLatin1String("/sys/devices/pci0000:00/0000:00:19.0/net/em1"));
+
+    /* Wired device properties */
+    fakeDevice->setCarrier(true);
+    fakeDevice->setHwAddress(QLatin1String("F0:DE:F1:FB:30:C1"));
+    fakeDevice->setPermanentHwAddress(QLatin1String("F0:DE:F1:FB:30:C1"));
+
+    fakeNetwork->addDevice(fakeDevice);
+
+    NetworkManager::ConnectionSettings::Ptr connectionSettings =
+        wiredConnectionSettings(QStringLiteral("Wired connection"), QStringLiteral("39af79a5-b053-4893-9378-7342a5a30d06"));
 
     NetworkManager::Device::Ptr wiredDevice = NetworkManager::networkInterfaces().first().objectCast<NetworkManager::Device>();
     QSignalSpy availableConnectionAppearedSpy(wiredDevice.data(), SIGNAL(availableConnectionAppeared(QString)));
@@ -64,6 +76,43 @@ void ActiveConnectionTest::initTestCase()
     QVERIFY(availableConnectionAppearedSpy.wait());
 }
 
+void ActiveConnectionTest::testAvailableConnections()
+{
+    NetworkManager::Device::Ptr wiredDevice = NetworkManager::networkInterfaces().first();
+    QCOMPARE(wiredDevice->availableConnectionCount(), 1);
+    const QString connectionPath = wiredDevice->availableConnectionPaths().constFirst();
+    QCOMPARE(wiredDevice->availableConnectionPaths(), QStringList{connectionPath});
+    QVERIFY(wiredDevice->isConnectionAvailable(connectionPath));
+    QVERIFY(!wiredDevice->isConnectionAvailable(QStringLiteral("/org/freedesktop/NetworkManager/Settings/0")));
+
+    QSignalSpy availableConnectionAppearedSpy(wiredDevice.data(), SIGNAL(availableConnectionAppeared(QString)));
+    QSignalSpy availableConnectionDisappearedSpy(wiredDevice.data(), SIGNAL(availableConnectionDisappeared(QString)));
+    QSignalSpy availableConnectionChangedSpy(wiredDevice.data(), SIGNAL(availableConnectionChanged()));
+
+    // Only the added connection is reported, the known one keeps its place
+    NetworkManager::addConnection(
+        wiredConnectionSettings(QStringLiteral("Second wired connection"), QStringLiteral("5a1e9c4e-7d0b-4f53-a2c6-0e8c4f1d9b27"))->toMap());
+    QVERIFY(availableConnectionAppearedSpy.wait());
+    const QString secondPath = availableConnectionAppearedSpy.at(0).at(0).toString();
+    QCOMPARE(availableConnectionAppearedSpy.count(), 1);
+    QCOMPARE(availableConnectionDisappearedSpy.count(), 0);
+    QCOMPARE(availableConnectionChangedSpy.count(), 1);
+    QCOMPARE(wiredDevice->availableConnectionCount(), 2);
+    QCOMPARE(wiredDevice->availableConnectionPaths(), (QStringList{connectionPath, secondPath}));
+    QVERIFY(wiredDevice->isConnectionAvailable(secondPath));
+
+    // Only the removed connection is reported, the other one stays
+    NetworkManager::findConnection(secondPath)->remove();
+    QVERIFY(availableConnectionDisappearedSpy.wait());
+    QCOMPARE(availableConnectionDisappearedSpy.at(0).at(0).toString(), secondPath);
+    QCOMPARE(availableConnectionAppearedSpy.count(), 1);
+    QCOMPARE(availableConnectionChangedSpy.count(), 2);
+    QCOMPARE(wiredDevice->availableConnectionCount(), 1);
+    QCOMPARE(wiredDevice->availableConnectionPaths(), QStringList{connectionPath});
+    QVERIFY(wiredDevice->isConnectionAvailable(connectionPath));
+    QVERIFY(!wiredDevice->isConnectionAvailable(secondPath));
+}
+
 void ActiveConnectionTest::testActiveConnection()
 {
     qRegisterMetaType<NetworkManager::ActiveConnection::State>("NetworkManager::ActiveConnection::State");
@@ -88,6 +137,9 @@ void ActiveConnectionTest::testActiveConnection()
     QSignalSpy primaryConnectionChangedSpy(NetworkManager::notifier(), SIGNAL(primaryConnectionChanged(QString)));
     QSignalSpy stateChangedSpy(NetworkManager::notifier(), SIGNAL(statusChanged(NetworkManager::Status)));
 
+    NetworkManager::ActivationTracer tracer;
+    QSignalSpy traceAddedSpy(&tracer, &NetworkManager::ActivationTracer::traceAdded);
+
     NetworkManager::activateConnection(connection->path(), device->uni(), QString());
     QVERIFY(activeConnectionAddedSpy.wait());
 
@@ -123,6 +175,22 @@ void ActiveConnectionTest::testActiveConnection()
     QCOMPARE(primaryConnectionChangedSpy.count(), 1);
     QCOMPARE(stateChangedSpy.count(), 1);
 
+    QCOMPARE(traceAddedSpy.count(), 1);
+    const NetworkManager::ActivationTracer::Trace trace = tracer.traces().constFirst();
+    QCOMPARE(trace.activeConnection, activeConnection->path());
+    QCOMPARE(trace.uuid, connection->uuid());
+    QCOMPARE(trace.device, device->uni());
+    QCOMPARE(trace.result, NetworkManager::ActiveConnection::Activated);
+    QCOMPARE(trace.phases.size(), 5);
+    QCOMPARE(trace.phases.constFirst().state, NetworkManager::Device::Preparing);
+    QVERIFY(trace.phaseDuration(NetworkManager::Device::NeedAuth) >= 0);
+    QCOMPARE(trace.phaseDuration(NetworkManager::Device::WaitingForSecondaries), -1);
+    QCOMPARE(tracer.percentile(50), trace.duration());
+    QCOMPARE(tracer.percentile(90, NetworkManager::Device::ConfiguringIp), trace.phaseDuration(NetworkManager::Device::ConfiguringIp));
+
+    const QJsonDocument chromeTrace = QJsonDocument::fromJson(tracer.toChromeTrace());
+    QCOMPARE(chromeTrace.object().value(QStringLiteral("traceEvents")).toArray().size(), 1 + 5 + 1);
+
     NetworkManager::deactivateConnection(activeConnection->path());
 
     // Wait until we are disconnected
@@ -137,4 +205,196 @@ void ActiveConnectionTest::testActiveConnection()
     QCOMPARE(NetworkManager::status(), NetworkManager::Disconnected);
 }
 
+void ActiveConnectionTest::testStateTransitions()
+{
+    NetworkManager::Device::Ptr device = NetworkManager::networkInterfaces().first();
+    NetworkManager::Connection::Ptr connection = device->availableConnections().first();
+
+    QSignalSpy activeConnectionAddedSpy(NetworkManager::notifier(), SIGNAL(activeConnectionAdded(QString)));
+    NetworkManager::activateConnection(connection->path(), device->uni(), QString());
+    QVERIFY(activeConnectionAddedSpy.wait());
+    NetworkManager::ActiveConnection::Ptr activeConnection = NetworkManager::findActiveConnection(activeConnectionAddedSpy.at(0).at(0).toString());
+
+    // Wait until device goes through all states (PREPARE, CONFIG, NEED_AUTH, IP_CONFIG, IP_CHECK, ACTIVATED)
+    QTest::qWait(800);
+
+    // The State property and the StateChanged signal are merged into one transition per state
+    const QList<NetworkManager::ActiveConnection::StateTransition> connectionTransitions = activeConnection->stateTransitions();
+    QCOMPARE(connectionTransitions.size(), 2);
+    QCOMPARE(connectionTransitions.at(0).state, NetworkManager::ActiveConnection::Activating);
+    QCOMPARE(connectionTransitions.at(1).state, NetworkManager::ActiveConnection::Activated);
+    QVERIFY(connectionTransitions.at(1).timestamp >= connectionTransitions.at(0).timestamp);
+
+    const QList<NetworkManager::Device::StateTransition> deviceTransitions = device->stateTransitions();
+    QVERIFY(deviceTransitions.size() >= 6);
+    QCOMPARE(deviceTransitions.constLast().newState, NetworkManager::Device::Activated);
+    for (int i = 1; i < deviceTransitions.size(); ++i) {
+        QCOMPARE(deviceTransitions.at(i).oldState, deviceTransitions.at(i - 1).newState);
+        QVERIFY(deviceTransitions.at(i).timestamp >= deviceTransitions.at(i - 1).timestamp);
+    }
+
+    NetworkManager::deactivateConnection(activeConnection->path());
+
+    // Wait until we are disconnected
+    QTest::qWait(300);
+
+    QCOMPARE(device->state(), NetworkManager::Device::Disconnected);
+
+    // Only the last 64 changes are kept, the oldest are dropped first
+    QSignalSpy deviceStateChangedSpy(
+        device.data(),
+        SIGNAL(stateChanged(NetworkManager::Device::State, NetworkManager::Device::State, NetworkManager::Device::StateChangeReason)));
+    for (int i = 0; i < 70; ++i) {
+        fakeDevice->setState(i % 2 ? NetworkManager::Device::Disconnected : NetworkManager::Device::Unavailable);
+    }
+    QTRY_COMPARE(deviceStateChangedSpy.count(), 70);
+
+    const QList<NetworkManager::Device::StateTransition> cappedTransitions = device->stateTransitions();
+    QCOMPARE(cappedTransitions.size(), 64);
+    // changes 0 to 5 were dropped, change 6 is the oldest one left
+    QCOMPARE(cappedTransitions.constFirst().oldState, NetworkManager::Device::Disconnected);
+    QCOMPARE(cappedTransitions.constFirst().newState, NetworkManager::Device::Unavailable);
+    QCOMPARE(cappedTransitions.constLast().newState, NetworkManager::Device::Disconnected);
+    QVERIFY(cappedTransitions.constFirst().timestamp > deviceTransitions.constLast().timestamp);
+    QCOMPARE(device->state(), NetworkManager::Device::Disconnected);
+}
+
+void ActiveConnectionTest::testBatchActivation()
+{
+    NetworkManager::Device::Ptr device = NetworkManager::networkInterfaces().first();
+    NetworkManager::Connection::Ptr connection = device->availableConnections().first();
+
+    NetworkManager::BatchActivation batch({NetworkManager::BatchActivation::Request::activate(connection->path(), device->uni())});
+    QSignalSpy itemFinishedSpy(&batch, &NetworkManager::BatchActivation::itemFinished);
+    QSignalSpy finishedSpy(&batch, &NetworkManager::BatchActivation::finished);
+    QCOMPARE(batch.count(), 1);
+    QVERIFY(!batch.isFinished());
+    QCOMPARE(batch.elapsed(), -1);
+
+    batch.start();
+    QVERIFY(finishedSpy.wait(5000));
+
+    QCOMPARE(itemFinishedSpy.count(), 1);
+    QCOMPARE(itemFinishedSpy.at(0).at(0).toInt(), 0);
+    QVERIFY(batch.isFinished());
+    QCOMPARE(batch.completedCount(), 1);
+    QCOMPARE(batch.failedCount(), 0);
+    QVERIFY(batch.elapsed() >= 0);
+
+    const NetworkManager::BatchActivation::Result result = batch.results().constFirst();
+    QVERIFY(result.isActivated());
+    QVERIFY(result.error.isEmpty());
+    QVERIFY(result.replyLatency >= 0);
+    QVERIFY(result.activationTime >= result.replyLatency);
+    QCOMPARE(device->state(), NetworkManager::Device::Activated);
+
+    NetworkManager::ActiveConnection::Ptr activeConnection = NetworkManager::findActiveConnection(result.activeConnection);
+    QVERIFY(activeConnection);
+    QCOMPARE(activeConnection->state(), NetworkManager::ActiveConnection::Activated);
+
+    NetworkManager::deactivateConnection(activeConnection->path());
+
+    // Wait until we are disconnected
+    QTest::qWait(300);
+
+    QCOMPARE(device->state(), NetworkManager::Device::Disconnected);
+}
+
+void ActiveConnectionTest::testBatchActivationSeveral()
+{
+    NetworkManager::Device::Ptr device = NetworkManager::networkInterfaces().first();
+    NetworkManager::Connection::Ptr connection = device->availableConnections().first();
+
+    // the fake server has no AddAndActivateConnection, so the second request is refused
+    NetworkManager::BatchActivation batch({NetworkManager::BatchActivation::Request::activate(connection->path(), device->uni()),
+                                           NetworkManager::BatchActivation::Request::addAndActivate(connection->settings()->toMap(), device->uni())});
+    QSignalSpy itemFinishedSpy(&batch, &NetworkManager::BatchActivation::itemFinished);
+    QSignalSpy progressSpy(&batch, &NetworkManager::BatchActivation::progress);
+    QSignalSpy finishedSpy(&batch, &NetworkManager::BatchActivation::finished);
+    QCOMPARE(batch.count(), 2);
+
+    batch.start();
+    QVERIFY(finishedSpy.wait(5000));
+
+    QCOMPARE(itemFinishedSpy.count(), 2);
+    QCOMPARE(progressSpy.count(), 2);
+    QCOMPARE(progressSpy.constLast().at(0).toInt(), 2);
+    QCOMPARE(batch.completedCount(), 2);
+    QCOMPARE(batch.failedCount(), 1);
+
+    const QList<NetworkManager::BatchActivation::Result> results = batch.results();
+    QVERIFY(results.at(0).isActivated());
+    QVERIFY(!results.at(1).isActivated());
+    QVERIFY(!results.at(1).error.isEmpty());
+    QVERIFY(results.at(1).activeConnection.isEmpty());
+
+    NetworkManager::deactivateConnection(results.at(0).activeConnection);
+
+    // Wait until we are disconnected
+    QTest::qWait(300);
+
+    QCOMPARE(device->state(), NetworkManager::Device::Disconnected);
+}
+
+void ActiveConnectionTest::testBatchActivationLateReply()
+{
+    NetworkManager::Connection::Ptr connection = NetworkManager::networkInterfaces().first()->availableConnections().first();
+
+    // without a device the active connection never settles
+    fakeNetwork->setActivationReplyDelay(500);
+    NetworkManager::BatchActivation batch({NetworkManager::BatchActivation::Request::activate(connection->path(), QString())});
+    batch.setTimeout(100);
+    QSignalSpy itemFinishedSpy(&batch, &NetworkManager::BatchActivation::itemFinished);
+    QSignalSpy finishedSpy(&batch, &NetworkManager::BatchActivation::finished);
+    QSignalSpy activeConnectionAddedSpy(NetworkManager::notifier(), &NetworkManager::Notifier::activeConnectionAdded);
+
+    batch.start();
+    QVERIFY(finishedSpy.wait(400));
+    QCOMPARE(batch.failedCount(), 1);
+    QVERIFY(batch.results().constFirst().activeConnection.isEmpty());
+    QCOMPARE(batch.results().constFirst().replyLatency, -1);
+
+    // the reply arriving afterwards leaves the finished item alone
+    QTest::qWait(600);
+    fakeNetwork->setActivationReplyDelay(0);
+    QCOMPARE(itemFinishedSpy.count(), 1);
+    QCOMPARE(finishedSpy.count(), 1);
+    QCOMPARE(batch.completedCount(), 1);
+    QVERIFY(batch.results().constFirst().activeConnection.isEmpty());
+
+    QCOMPARE(activeConnectionAddedSpy.count(), 1);
+    QSignalSpy activeConnectionRemovedSpy(NetworkManager::notifier(), &NetworkManager::Notifier::activeConnectionRemoved);
+    fakeNetwork->removeActiveConnection(QDBusObjectPath(activeConnectionAddedSpy.at(0).at(0).toString()));
+    QVERIFY(activeConnectionRemovedSpy.wait());
+    QCOMPARE(itemFinishedSpy.count(), 1);
+}
+
+void ActiveConnectionTest::testBatchActivationRemovedBeforeReply()
+{
+    NetworkManager::Connection::Ptr connection = NetworkManager::networkInterfaces().first()->availableConnections().first();
+
+    fakeNetwork->setActivationReplyDelay(500);
+    NetworkManager::BatchActivation batch({NetworkManager::BatchActivation::Request::activate(connection->path(), QString())});
+    batch.setTimeout(10000);
+    QSignalSpy finishedSpy(&batch, &NetworkManager::BatchActivation::finished);
+    QSignalSpy activeConnectionAddedSpy(NetworkManager::notifier(), &NetworkManager::Notifier::activeConnectionAdded);
+    QSignalSpy activeConnectionRemovedSpy(NetworkManager::notifier(), &NetworkManager::Notifier::activeConnectionRemoved);
+
+    batch.start();
+    QVERIFY(activeConnectionAddedSpy.wait());
+    const QString path = activeConnectionAddedSpy.at(0).at(0).toString();
+    fakeNetwork->removeActiveConnection(QDBusObjectPath(path));
+    QVERIFY(activeConnectionRemovedSpy.wait());
+    QVERIFY(!batch.isFinished());
+
+    // fails as soon as the reply names the removed connection, not after the timeout
+    QVERIFY(finishedSpy.wait(2000));
+    fakeNetwork->setActivationReplyDelay(0);
+    QVERIFY(batch.elapsed() < 2000);
+    const NetworkManager::BatchActivation::Result result = batch.results().constFirst();
+    QCOMPARE(result.activeConnection, path);
+    QCOMPARE(result.state, NetworkManager::ActiveConnection::Deactivated);
+    QVERIFY(!result.error.isEmpty());
+}
+
 QTEST_MAIN(ActiveConnectionTest)
@@ -11,16 +11,25 @@
 
 #include "fakenetwork/fakenetwork.h"
 
+class WiredDevice;
+
 class ActiveConnectionTest : public QObject
 {
     Q_OBJECT
 
 private Q_SLOTS:
     void initTestCase();
+    void testAvailableConnections();
     void testActiveConnection();
+    void testStateTransitions();
+    void testBatchActivation();
+    void testBatchActivationSeveral();
+    void testBatchActivationLateReply();
+    void testBatchActivationRemovedBeforeReply();
 
 private:
     FakeNetwork *fakeNetwork;
+    WiredDevice *fakeDevice;
 };
 
 #endif // NETWORKMANAGERQT_ACTIVE_CONNECTION_TEST_H
@@ -0,0 +1,249 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "asyncsecretagenttest.h"
+
+#include <libnm/NetworkManager.h>
+
+#include <QDBusMessage>
+#include <QDBusMetaType>
+#include <QDBusPendingReply>
+#include <QTest>
+
+static NMVariantMapMap secretsWithPsk(const QString &psk)
+{
+    NMVariantMapMap secrets;
+    secrets[QStringLiteral("802-11-wireless-security")][QStringLiteral("psk")] = psk;
+    return secrets;
+}
+
+TestSecretAgent::TestSecretAgent(QObject *parent)
+    : AsyncSecretAgent(QStringLiteral("org.kde.networkmanagerqt.asyncsecretagenttest"), parent)
+{
+}
+
+void TestSecretAgent::SaveSecrets(const NMVariantMapMap &connection, const QDBusObjectPath &connection_path)
+{
+    Q_UNUSED(connection)
+    Q_UNUSED(connection_path)
+}
+
+void TestSecretAgent::DeleteSecrets(const NMVariantMapMap &connection, const QDBusObjectPath &connection_path)
+{
+    Q_UNUSED(connection)
+    Q_UNUSED(connection_path)
+}
+
+void TestSecretAgent::requestSecrets(const NetworkManager::AsyncSecretAgent::Request &request)
+{
+    requests << request;
+}
+
+void TestSecretAgent::requestCanceled(quint64 id)
+{
+    canceled << id;
+}
+
+void AsyncSecretAgentTest::initTestCase()
+{
+    agent = new TestSecretAgent();
+
+    // a second connection, NetworkManager's calls come from another peer as well
+    client = QDBusConnection::connectToBus(QDBusConnection::SessionBus, QStringLiteral("asyncsecretagenttest"));
+    QVERIFY(client.isConnected());
+}
+
+void AsyncSecretAgentTest::init()
+{
+    agent->requests.clear();
+    agent->canceled.clear();
+    agent->clearCache();
+    agent->setMaxConcurrentRequests(1);
+    agent->setCacheLifetime(10000);
+}
+
+void AsyncSecretAgentTest::cleanupTestCase()
+{
+    QDBusConnection::disconnectFromBus(QStringLiteral("asyncsecretagenttest"));
+    delete agent;
+}
+
+QDBusPendingCall AsyncSecretAgentTest::getSecrets(const QString &connectionPath, uint flags)
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                          QLatin1String(NM_DBUS_PATH_SECRET_AGENT),
+                                                          QLatin1String(NM_DBUS_INTERFACE_SECRET_AGENT),
+                                                          QStringLiteral("GetSecrets"));
+    message << QVariant::fromValue(NMVariantMapMap()) << QVariant::fromValue(QDBusObjectPath(connectionPath))
+            << QStringLiteral("802-11-wireless-security") << QStringList() << flags;
+    return client.asyncCall(message);
+}
+
+void AsyncSecretAgentTest::testDeduplication()
+{
+    const QString path = QStringLiteral("/org/freedesktop/NetworkManager/Settings/1");
+    QDBusPendingReply<NMVariantMapMap> first = getSecrets(path);
+    QDBusPendingReply<NMVariantMapMap> second = getSecrets(path);
+
+    // both calls are in, the second one joined the first request
+    QTRY_COMPARE(agent->requests.size(), 1);
+    QTest::qWait(100);
+    QCOMPARE(agent->requests.size(), 1);
+    QCOMPARE(agent->runningCount(), 1);
+    QCOMPARE(agent->queuedCount(), 0);
+    QVERIFY(!first.isFinished());
+    QVERIFY(!second.isFinished());
+
+    const NetworkManager::AsyncSecretAgent::Request request = agent->requests.constFirst();
+    QCOMPARE(request.connectionPath.path(), path);
+    QCOMPARE(request.settingName, QStringLiteral("802-11-wireless-security"));
+    QVERIFY(request.flags.testFlag(NetworkManager::SecretAgent::AllowInteraction));
+
+    agent->finishRequest(request.id, secretsWithPsk(QStringLiteral("secret")), false);
+    QTRY_VERIFY(first.isFinished() && second.isFinished());
+    QVERIFY(!first.isError());
+    QVERIFY(!second.isError());
+    QCOMPARE(first.value(), secretsWithPsk(QStringLiteral("secret")));
+    QCOMPARE(second.value(), secretsWithPsk(QStringLiteral("secret")));
+    QCOMPARE(agent->runningCount(), 0);
+}
+
+void AsyncSecretAgentTest::testConcurrencyLimit()
+{
+    agent->setMaxConcurrentRequests(2);
+
+    QDBusPendingReply<NMVariantMapMap> first = getSecrets(QStringLiteral("/org/freedesktop/NetworkManager/Settings/1"));
+    QDBusPendingReply<NMVariantMapMap> second = getSecrets(QStringLiteral("/org/freedesktop/NetworkManager/Settings/2"));
+    QDBusPendingReply<NMVariantMapMap> third = getSecrets(QStringLiteral("/org/freedesktop/NetworkManager/Settings/3"));
+
+    QTRY_COMPARE(agent->runningCount() + agent->queuedCount(), 3);
+    QCOMPARE(agent->runningCount(), 2);
+    QCOMPARE(agent->queuedCount(), 1);
+    QCOMPARE(agent->requests.size(), 2);
+
+    // a failed request frees its slot as well
+    agent->failRequest(agent->requests.at(0).id, NetworkManager::SecretAgent::NoSecrets, QStringLiteral("No secrets"));
+    QCOMPARE(agent->requests.size(), 3);
+    QCOMPARE(agent->requests.at(2).connectionPath.path(), QStringLiteral("/org/freedesktop/NetworkManager/Settings/3"));
+    QCOMPARE(agent->runningCount(), 2);
+    QCOMPARE(agent->queuedCount(), 0);
+
+    QTRY_VERIFY(first.isFinished());
+    QVERIFY(first.isError());
+    QCOMPARE(first.error().name(), QLatin1String(NM_DBUS_INTERFACE_SECRET_AGENT ".NoSecrets"));
+
+    agent->finishRequest(agent->requests.at(1).id, secretsWithPsk(QStringLiteral("two")), false);
+    agent->finishRequest(agent->requests.at(2).id, secretsWithPsk(QStringLiteral("three")), false);
+    QTRY_VERIFY(second.isFinished() && third.isFinished());
+    QCOMPARE(second.value(), secretsWithPsk(QStringLiteral("two")));
+    QCOMPARE(third.value(), secretsWithPsk(QStringLiteral("three")));
+    QCOMPARE(agent->runningCount(), 0);
+}
+
+void AsyncSecretAgentTest::testCache()
+{
+    const QString path = QStringLiteral("/org/freedesktop/NetworkManager/Settings/1");
+    // larger than any fixed size buffer guess, the cache has to keep all of it
+    const NMVariantMapMap secrets = secretsWithPsk(QString(20000, QLatin1Char('x')));
+
+    QDBusPendingReply<NMVariantMapMap> first = getSecrets(path);
+    QTRY_COMPARE(agent->requests.size(), 1);
+    agent->finishRequest(agent->requests.constFirst().id, secrets);
+    QTRY_VERIFY(first.isFinished());
+    QCOMPARE(first.value(), secrets);
+
+    // answered from the cache without asking again
+    QDBusPendingReply<NMVariantMapMap> cached = getSecrets(path);
+    QTRY_VERIFY(cached.isFinished());
+    QVERIFY(!cached.isError());
+    QCOMPARE(cached.value(), secrets);
+    QCOMPARE(agent->requests.size(), 1);
+
+    // unless NetworkManager says the secrets are wrong
+    QDBusPendingReply<NMVariantMapMap> renewed = getSecrets(path, uint(NetworkManager::SecretAgent::AllowInteraction) | uint(NetworkManager::SecretAgent::RequestNew));
+    QTRY_COMPARE(agent->requests.size(), 2);
+    QVERIFY(agent->requests.constLast().flags.testFlag(NetworkManager::SecretAgent::RequestNew));
+    agent->finishRequest(agent->requests.constLast().id, secretsWithPsk(QStringLiteral("new")));
+    QTRY_VERIFY(renewed.isFinished());
+    QCOMPARE(renewed.value(), secretsWithPsk(QStringLiteral("new")));
+
+    // or the secrets of the connection were invalidated
+    agent->invalidateCache(QDBusObjectPath(path));
+    QDBusPendingReply<NMVariantMapMap> invalidated = getSecrets(path);
+    QTRY_COMPARE(agent->requests.size(), 3);
+    agent->failRequest(agent->requests.constLast().id, NetworkManager::SecretAgent::UserCanceled, QStringLiteral("Canceled"));
+    QTRY_VERIFY(invalidated.isFinished());
+    QVERIFY(invalidated.isError());
+}
+
+void AsyncSecretAgentTest::testCacheExpiry()
+{
+    agent->setCacheLifetime(200);
+    const QString path = QStringLiteral("/org/freedesktop/NetworkManager/Settings/1");
+
+    QDBusPendingReply<NMVariantMapMap> first = getSecrets(path);
+    QTRY_COMPARE(agent->requests.size(), 1);
+    agent->finishRequest(agent->requests.constFirst().id, secretsWithPsk(QStringLiteral("secret")));
+    QTRY_VERIFY(first.isFinished());
+
+    QDBusPendingReply<NMVariantMapMap> cached = getSecrets(path);
+    QTRY_VERIFY(cached.isFinished());
+    QCOMPARE(agent->requests.size(), 1);
+
+    // once expired the subclass is asked again
+    QTest::qWait(300);
+    QDBusPendingReply<NMVariantMapMap> expired = getSecrets(path);
+    QTRY_COMPARE(agent->requests.size(), 2);
+    QVERIFY(!expired.isFinished());
+    agent->finishRequest(agent->requests.constLast().id, secretsWithPsk(QStringLiteral("secret")), false);
+    QTRY_VERIFY(expired.isFinished());
+    QVERIFY(!expired.isError());
+}
+
+void AsyncSecretAgentTest::testCancel()
+{
+    const QString path = QStringLiteral("/org/freedesktop/NetworkManager/Settings/1");
+    const QString queuedPath = QStringLiteral("/org/freedesktop/NetworkManager/Settings/2");
+
+    QDBusPendingReply<NMVariantMapMap> running = getSecrets(path);
+    QDBusPendingReply<NMVariantMapMap> queued = getSecrets(queuedPath);
+    QTRY_COMPARE(agent->queuedCount(), 1);
+    QCOMPARE(agent->requests.size(), 1);
+    const quint64 runningId = agent->requests.constFirst().id;
+
+    QDBusMessage cancel = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                         QLatin1String(NM_DBUS_PATH_SECRET_AGENT),
+                                                         QLatin1String(NM_DBUS_INTERFACE_SECRET_AGENT),
+                                                         QStringLiteral("CancelGetSecrets"));
+    cancel << QVariant::fromValue(QDBusObjectPath(path)) << QStringLiteral("802-11-wireless-security");
+    QDBusPendingCall cancelCall = client.asyncCall(cancel);
+
+    // the running request is answered with an error and the queued one moves up
+    QTRY_VERIFY(running.isFinished());
+    QVERIFY(running.isError());
+    QCOMPARE(running.error().name(), QLatin1String(NM_DBUS_INTERFACE_SECRET_AGENT ".AgentCanceled"));
+    QCOMPARE(agent->canceled, QList<quint64>{runningId});
+    QCOMPARE(agent->requests.size(), 2);
+    QCOMPARE(agent->requests.constLast().connectionPath.path(), queuedPath);
+    QCOMPARE(agent->queuedCount(), 0);
+    QTRY_VERIFY(cancelCall.isFinished());
+
+    // finishing the canceled request has no effect anymore
+    agent->finishRequest(runningId, secretsWithPsk(QStringLiteral("late")));
+    QCOMPARE(agent->runningCount(), 1);
+
+    agent->finishRequest(agent->requests.constLast().id, secretsWithPsk(QStringLiteral("queued")), false);
+    QTRY_VERIFY(queued.isFinished());
+    QCOMPARE(queued.value(), secretsWithPsk(QStringLiteral("queued")));
+
+    // a canceled request isn't cached, the next call asks again
+    QDBusPendingReply<NMVariantMapMap> again = getSecrets(path);
+    QTRY_COMPARE(agent->requests.size(), 3);
+    agent->failRequest(agent->requests.constLast().id, NetworkManager::SecretAgent::UserCanceled, QStringLiteral("Canceled"));
+    QTRY_VERIFY(again.isFinished());
+}
+
+QTEST_MAIN(AsyncSecretAgentTest)
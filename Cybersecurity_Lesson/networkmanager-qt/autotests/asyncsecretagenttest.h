@@ -0,0 +1,57 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_ASYNC_SECRETAGENT_TEST_H
+#define NETWORKMANAGERQT_ASYNC_SECRETAGENT_TEST_H
+
+#include <QDBusConnection>
+#include <QDBusPendingCall>
+#include <QObject>
+
+#include "asyncsecretagent.h"
+
+// Records the requests it is given, the test answers them
+class TestSecretAgent : public NetworkManager::AsyncSecretAgent
+{
+public:
+    explicit TestSecretAgent(QObject *parent = nullptr);
+
+    using AsyncSecretAgent::failRequest;
+    using AsyncSecretAgent::finishRequest;
+
+    void SaveSecrets(const NMVariantMapMap &connection, const QDBusObjectPath &connection_path) override;
+    void DeleteSecrets(const NMVariantMapMap &connection, const QDBusObjectPath &connection_path) override;
+
+    QList<NetworkManager::AsyncSecretAgent::Request> requests;
+    QList<quint64> canceled;
+
+protected:
+    void requestSecrets(const NetworkManager::AsyncSecretAgent::Request &request) override;
+    void requestCanceled(quint64 id) override;
+};
+
+class AsyncSecretAgentTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void init();
+    void cleanupTestCase();
+    void testDeduplication();
+    void testConcurrencyLimit();
+    void testCache();
+    void testCacheExpiry();
+    void testCancel();
+
+private:
+    QDBusPendingCall getSecrets(const QString &connectionPath, uint flags = NetworkManager::SecretAgent::AllowInteraction);
+
+    TestSecretAgent *agent = nullptr;
+    QDBusConnection client = QDBusConnection(QString());
+};
+
+#endif // NETWORKMANAGERQT_ASYNC_SECRETAGENT_TEST_H
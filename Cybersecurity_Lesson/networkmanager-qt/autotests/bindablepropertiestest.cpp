@@ -0,0 +1,145 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "bindablepropertiestest.h"
+
+#include "manager.h"
+#include "wirelessdevice.h"
+
+#include "fakenetwork/wireddevice.h"
+
+#include <QProperty>
+#include <QSignalSpy>
+#include <QTest>
+
+void BindablePropertiesTest::initTestCase()
+{
+    fakeNetwork = new FakeNetwork();
+
+    fakeAccessPoint = new AccessPoint();
+    fakeAccessPoint->setSsid(QByteArrayLiteral("home"));
+    fakeAccessPoint->setFrequency(2437);
+    fakeAccessPoint->setStrength(40);
+
+    fakeWirelessDevice = new WirelessDevice();
+    fakeWirelessDevice->setDeviceType(2);
+    fakeWirelessDevice->setInterface(QLatin1String("wlp3s0"));
+    fakeWirelessDevice->setManaged(true);
+    fakeWirelessDevice->setBitrate(54000);
+    fakeWirelessDevice->addAccessPoint(fakeAccessPoint);
+
+    QSignalSpy addDeviceSpy(NetworkManager::notifier(), SIGNAL(deviceAdded(QString)));
+    fakeNetwork->addDevice(fakeWirelessDevice);
+    QVERIFY(addDeviceSpy.wait());
+    wirelessDevicePath = addDeviceSpy.at(0).at(0).toString();
+
+    NetworkManager::WirelessDevice::Ptr wirelessDevice = NetworkManager::findNetworkInterface(wirelessDevicePath).objectCast<NetworkManager::WirelessDevice>();
+    QVERIFY(wirelessDevice);
+    QCOMPARE(wirelessDevice->accessPoints().count(), 1);
+    QVERIFY(wirelessDevice->findNetwork(QStringLiteral("home")));
+}
+
+void BindablePropertiesTest::cleanupTestCase()
+{
+    fakeNetwork->removeDevice(fakeWirelessDevice);
+    delete fakeWirelessDevice;
+    delete fakeNetwork;
+}
+
+void BindablePropertiesTest::testDeviceState()
+{
+    WiredDevice *fakeDevice = new WiredDevice();
+    fakeDevice->setDeviceType(1);
+    fakeDevice->setInterface(QLatin1String("em1"));
+    fakeDevice->setManaged(true);
+
+    QSignalSpy addDeviceSpy(NetworkManager::notifier(), SIGNAL(deviceAdded(QString)));
+    fakeNetwork->addDevice(fakeDevice);
+    QVERIFY(addDeviceSpy.wait());
+
+    NetworkManager::Device::Ptr device = NetworkManager::findNetworkInterface(addDeviceSpy.at(0).at(0).toString());
+    QVERIFY(device);
+    QCOMPARE(device->state(), NetworkManager::Device::Disconnected);
+
+    QProperty<NetworkManager::Device::State> state;
+    state.setBinding(device->bindableState().makeBinding());
+    QCOMPARE(state.value(), NetworkManager::Device::Disconnected);
+
+    // the NOTIFY signal of the property goes out however the state changes
+    QSignalSpy connectionStateSpy(device.data(), SIGNAL(connectionStateChanged()));
+    fakeDevice->setState(100);
+    QTRY_COMPARE(state.value(), NetworkManager::Device::Activated);
+    QCOMPARE(device->state(), NetworkManager::Device::Activated);
+    QCOMPARE(connectionStateSpy.count(), 1);
+
+    fakeDevice->setState(30);
+    QTRY_COMPARE(state.value(), NetworkManager::Device::Disconnected);
+    QCOMPARE(connectionStateSpy.count(), 2);
+
+    QSignalSpy removeDeviceSpy(NetworkManager::notifier(), SIGNAL(deviceRemoved(QString)));
+    fakeNetwork->removeDevice(fakeDevice);
+    QVERIFY(removeDeviceSpy.wait());
+    delete fakeDevice;
+}
+
+void BindablePropertiesTest::testWirelessDeviceBitRate()
+{
+    NetworkManager::WirelessDevice::Ptr wirelessDevice = NetworkManager::findNetworkInterface(wirelessDevicePath).objectCast<NetworkManager::WirelessDevice>();
+    QVERIFY(wirelessDevice);
+    QCOMPARE(wirelessDevice->bitRate(), 54000);
+
+    QProperty<int> bitRate;
+    bitRate.setBinding(wirelessDevice->bindableBitRate().makeBinding());
+    QCOMPARE(bitRate.value(), 54000);
+
+    QSignalSpy bitRateSpy(wirelessDevice.data(), SIGNAL(bitRateChanged(int)));
+    fakeWirelessDevice->setBitrate(300000);
+    QTRY_COMPARE(bitRate.value(), 300000);
+    QCOMPARE(bitRateSpy.count(), 1);
+}
+
+void BindablePropertiesTest::testAccessPointSignalStrength()
+{
+    NetworkManager::WirelessDevice::Ptr wirelessDevice = NetworkManager::findNetworkInterface(wirelessDevicePath).objectCast<NetworkManager::WirelessDevice>();
+    QVERIFY(wirelessDevice);
+    NetworkManager::AccessPoint::Ptr accessPoint = wirelessDevice->findAccessPoint(fakeAccessPoint->accessPointPath());
+    QVERIFY(accessPoint);
+    QCOMPARE(accessPoint->ssid(), QStringLiteral("home"));
+
+    QProperty<int> signalStrength;
+    signalStrength.setBinding(accessPoint->bindableSignalStrength().makeBinding());
+    QProperty<QString> ssid;
+    ssid.setBinding(accessPoint->bindableSsid().makeBinding());
+    QCOMPARE(ssid.value(), QStringLiteral("home"));
+
+    QCOMPARE(signalStrength.value(), 40);
+
+    QSignalSpy signalStrengthSpy(accessPoint.data(), SIGNAL(signalStrengthChanged(int)));
+    fakeAccessPoint->setStrength(75);
+    QTRY_COMPARE(signalStrength.value(), 75);
+    QCOMPARE(accessPoint->signalStrength(), 75);
+    QCOMPARE(signalStrengthSpy.count(), 1);
+}
+
+void BindablePropertiesTest::testWirelessNetworkSignalStrength()
+{
+    NetworkManager::WirelessDevice::Ptr wirelessDevice = NetworkManager::findNetworkInterface(wirelessDevicePath).objectCast<NetworkManager::WirelessDevice>();
+    QVERIFY(wirelessDevice);
+    NetworkManager::WirelessNetwork::Ptr network = wirelessDevice->findNetwork(QStringLiteral("home"));
+    QVERIFY(network);
+
+    // the network follows the strongest of its access points
+    QProperty<int> signalStrength;
+    signalStrength.setBinding(network->bindableSignalStrength().makeBinding());
+    QCOMPARE(signalStrength.value(), network->signalStrength());
+
+    QSignalSpy signalStrengthSpy(network.data(), SIGNAL(signalStrengthChanged(int)));
+    fakeAccessPoint->setStrength(90);
+    QTRY_COMPARE(signalStrength.value(), 90);
+    QCOMPARE(signalStrengthSpy.count(), 1);
+}
+
+QTEST_MAIN(BindablePropertiesTest)
@@ -0,0 +1,34 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_BINDABLE_PROPERTIES_TEST_H
+#define NETWORKMANAGERQT_BINDABLE_PROPERTIES_TEST_H
+
+#include <QObject>
+
+#include "fakenetwork/fakenetwork.h"
+#include "fakenetwork/wirelessdevice.h"
+
+class BindablePropertiesTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void testDeviceState();
+    void testWirelessDeviceBitRate();
+    void testAccessPointSignalStrength();
+    void testWirelessNetworkSignalStrength();
+
+private:
+    FakeNetwork *fakeNetwork;
+    WirelessDevice *fakeWirelessDevice;
+    AccessPoint *fakeAccessPoint;
+    QString wirelessDevicePath;
+};
+
+#endif // NETWORKMANAGERQT_BINDABLE_PROPERTIES_TEST_H
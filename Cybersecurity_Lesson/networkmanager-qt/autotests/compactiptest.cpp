@@ -0,0 +1,104 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "compactiptest.h"
+
+#include "compactip.h"
+#include "ipaddress.h"
+#include "iproute.h"
+
+#include <QTest>
+
+void CompactIpTest::testString_data()
+{
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("ipv4") << QStringLiteral("192.168.1.1");
+    QTest::newRow("ipv4 any") << QStringLiteral("0.0.0.0");
+    QTest::newRow("ipv4 broadcast") << QStringLiteral("255.255.255.255");
+    QTest::newRow("ipv6 any") << QStringLiteral("::");
+    QTest::newRow("ipv6 loopback") << QStringLiteral("::1");
+    QTest::newRow("ipv6") << QStringLiteral("2001:db8::8a2e:370:7334");
+    QTest::newRow("ipv6 full") << QStringLiteral("2001:0db8:0001:0002:0003:0004:0005:0006");
+    QTest::newRow("ipv6 longest run") << QStringLiteral("2001:0:0:1:0:0:0:1");
+    QTest::newRow("ipv6 single zero") << QStringLiteral("2001:db8:0:1:1:1:1:1");
+    QTest::newRow("ipv6 link local") << QStringLiteral("FE80::0202:B3FF:FE1E:8329");
+    QTest::newRow("ipv4 mapped") << QStringLiteral("::ffff:192.168.1.1");
+    QTest::newRow("ipv4 compatible") << QStringLiteral("::10.0.0.1");
+    QTest::newRow("ipv6 trailing ipv4") << QStringLiteral("64:ff9b::192.0.2.33");
+}
+
+void CompactIpTest::testString()
+{
+    QFETCH(QString, text);
+
+    const QHostAddress expected(text);
+    QVERIFY(!expected.isNull());
+
+    const NetworkManager::CompactIp ip = NetworkManager::CompactIp::fromString(text);
+    QVERIFY(ip.isValid());
+    QCOMPARE(ip.toHostAddress(), expected);
+    QCOMPARE(ip.toString(), expected.toString());
+    QCOMPARE(ip, NetworkManager::CompactIp::fromHostAddress(expected));
+
+    char buffer[NetworkManager::CompactIp::MaxStringLength];
+    QCOMPARE(ip.format(buffer), int(expected.toString().size()));
+    QCOMPARE(QLatin1String(buffer), expected.toString());
+}
+
+void CompactIpTest::testInvalid_data()
+{
+    QTest::addColumn<QString>("text");
+
+    QTest::newRow("empty") << QString();
+    QTest::newRow("ipv4 short") << QStringLiteral("192.168.1");
+    QTest::newRow("ipv4 octet") << QStringLiteral("192.168.1.256");
+    QTest::newRow("ipv4 leading zero") << QStringLiteral("192.168.01.1");
+    QTest::newRow("ipv4 trailing dot") << QStringLiteral("192.168.1.1.");
+    QTest::newRow("ipv6 double gap") << QStringLiteral("2001::1::1");
+    QTest::newRow("ipv6 group") << QStringLiteral("2001:db8::12345");
+    QTest::newRow("ipv6 too long") << QStringLiteral("1:2:3:4:5:6:7:8:9");
+    QTest::newRow("ipv6 single colon") << QStringLiteral(":1::");
+    QTest::newRow("ipv6 trailing colon") << QStringLiteral("1:2:3:4:5:6:7:");
+    QTest::newRow("hostname") << QStringLiteral("localhost");
+}
+
+void CompactIpTest::testInvalid()
+{
+    QFETCH(QString, text);
+
+    QVERIFY(!NetworkManager::CompactIp::fromString(text).isValid());
+}
+
+void CompactIpTest::testConversion()
+{
+    NetworkManager::IpAddress address;
+    address.setIp(QHostAddress(QStringLiteral("10.0.0.2")));
+    address.setPrefixLength(24);
+    address.setGateway(QHostAddress(QStringLiteral("10.0.0.1")));
+
+    const NetworkManager::CompactIpAddress compactAddress = address.toCompact();
+    QCOMPARE(compactAddress.address.toIPv4(), 0x0a000002u);
+    QCOMPARE(compactAddress.prefixLength, quint8(24));
+    QCOMPARE(NetworkManager::IpAddress(compactAddress), address);
+
+    NetworkManager::IpRoute route;
+    route.setIp(QHostAddress(QStringLiteral("2001:db8::")));
+    route.setPrefixLength(64);
+    route.setNextHop(QHostAddress(QStringLiteral("fe80::1")));
+    route.setMetric(100);
+
+    const NetworkManager::CompactIpRoute compactRoute = route.toCompact();
+    QCOMPARE(compactRoute.destination.family, NetworkManager::CompactIp::IPv6);
+    QCOMPARE(compactRoute.metric, 100u);
+    const NetworkManager::IpRoute converted(compactRoute);
+    QCOMPARE(converted.ip(), route.ip());
+    QCOMPARE(converted.prefixLength(), route.prefixLength());
+    QCOMPARE(converted.nextHop(), route.nextHop());
+    QCOMPARE(converted.metric(), route.metric());
+}
+
+QTEST_MAIN(CompactIpTest)
@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_COMPACTIP_TEST_H
+#define NETWORKMANAGERQT_COMPACTIP_TEST_H
+
+#include <QObject>
+
+class CompactIpTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testString_data();
+    void testString();
+    void testInvalid_data();
+    void testInvalid();
+    void testConversion();
+};
+
+#endif // NETWORKMANAGERQT_COMPACTIP_TEST_H
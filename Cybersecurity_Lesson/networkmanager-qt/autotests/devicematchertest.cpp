@@ -0,0 +1,105 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "devicematchertest.h"
+
+#include "devicematcher.h"
+
+#include <QTest>
+
+void DeviceMatcherTest::testPatterns_data()
+{
+    QTest::addColumn<QStringList>("patterns");
+    QTest::addColumn<QString>("interfaceName");
+    QTest::addColumn<bool>("matches");
+
+    QTest::newRow("empty") << QStringList() << QStringLiteral("eth0") << true;
+    QTest::newRow("literal") << QStringList{QStringLiteral("eth0")} << QStringLiteral("eth0") << true;
+    QTest::newRow("literal mismatch") << QStringList{QStringLiteral("eth0")} << QStringLiteral("eth1") << false;
+    QTest::newRow("optional or") << QStringList{QStringLiteral("eth0"), QStringLiteral("|wlan*")} << QStringLiteral("wlan1") << true;
+    QTest::newRow("prefix") << QStringList{QStringLiteral("enp*")} << QStringLiteral("enp0s31f6") << true;
+    QTest::newRow("suffix") << QStringList{QStringLiteral("*-lab")} << QStringLiteral("br-lab") << true;
+    QTest::newRow("everything") << QStringList{QStringLiteral("*")} << QStringLiteral("veth3") << true;
+    QTest::newRow("question mark") << QStringList{QStringLiteral("eth?")} << QStringLiteral("eth7") << true;
+    QTest::newRow("question mark length") << QStringList{QStringLiteral("eth?")} << QStringLiteral("eth10") << false;
+    QTest::newRow("class") << QStringList{QStringLiteral("eth[0-3]")} << QStringLiteral("eth2") << true;
+    QTest::newRow("class mismatch") << QStringList{QStringLiteral("eth[0-3]")} << QStringLiteral("eth5") << false;
+    QTest::newRow("negated class") << QStringList{QStringLiteral("eth[!0-3]")} << QStringLiteral("eth5") << true;
+    QTest::newRow("generic") << QStringList{QStringLiteral("en*s*f?")} << QStringLiteral("enp0s31f6") << true;
+    QTest::newRow("generic backtracking") << QStringList{QStringLiteral("*a*b")} << QStringLiteral("xaxbxab") << true;
+    QTest::newRow("generic mismatch") << QStringList{QStringLiteral("*a*b")} << QStringLiteral("xaxbxa") << false;
+    QTest::newRow("inverted is mandatory") << QStringList{QStringLiteral("!eth0")} << QStringLiteral("eth1") << true;
+    QTest::newRow("inverted excludes") << QStringList{QStringLiteral("eth*"), QStringLiteral("!eth0")} << QStringLiteral("eth0") << false;
+    QTest::newRow("inverted and optional") << QStringList{QStringLiteral("eth*"), QStringLiteral("!eth0")} << QStringLiteral("eth1") << true;
+    QTest::newRow("optional inverted") << QStringList{QStringLiteral("eth0"), QStringLiteral("|!wlan*")} << QStringLiteral("veth0") << true;
+    QTest::newRow("mandatory") << QStringList{QStringLiteral("&e*"), QStringLiteral("&*0")} << QStringLiteral("eth1") << false;
+    QTest::newRow("mandatory all") << QStringList{QStringLiteral("&e*"), QStringLiteral("&*0")} << QStringLiteral("eth0") << true;
+    QTest::newRow("escaped") << QStringList{QStringLiteral("\\!odd")} << QStringLiteral("!odd") << true;
+    QTest::newRow("escaped star") << QStringList{QStringLiteral("a\\*")} << QStringLiteral("ab") << false;
+}
+
+void DeviceMatcherTest::testPatterns()
+{
+    QFETCH(QStringList, patterns);
+    QFETCH(QString, interfaceName);
+    QFETCH(bool, matches);
+
+    const NetworkManager::DeviceMatcher matcher(patterns);
+    QCOMPARE(matcher.matches(interfaceName), matches);
+    QCOMPARE(matcher.matchesAll(), patterns.isEmpty());
+}
+
+void DeviceMatcherTest::testDriver()
+{
+    NetworkManager::MatchSetting setting;
+    setting.setInterfaceName({QStringLiteral("en*")});
+    setting.setDriver({QStringLiteral("e1000*"), QStringLiteral("igb")});
+
+    const NetworkManager::DeviceMatcher matcher(setting);
+    const QList<NetworkManager::DeviceMatcher::Candidate> candidates{
+        {QStringLiteral("enp1s0"), QStringLiteral("e1000e")},
+        {QStringLiteral("enp2s0"), QStringLiteral("r8169")},
+        {QStringLiteral("wlp3s0"), QStringLiteral("igb")},
+        {QStringLiteral("enp4s0"), QStringLiteral("igb")},
+    };
+
+    const QBitArray matched = matcher.matches(candidates);
+    QCOMPARE(matched.size(), 4);
+    QVERIFY(matched.testBit(0));
+    QVERIFY(!matched.testBit(1));
+    QVERIFY(!matched.testBit(2));
+    QVERIFY(matched.testBit(3));
+}
+
+void DeviceMatcherTest::testConnections()
+{
+    NetworkManager::ConnectionSettings::Ptr any(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
+    any->setUuid(QStringLiteral("00000000-0000-0000-0000-000000000001"));
+
+    NetworkManager::ConnectionSettings::Ptr bound(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
+    bound->setUuid(QStringLiteral("00000000-0000-0000-0000-000000000002"));
+    bound->setInterfaceName(QStringLiteral("eth1"));
+
+    NetworkManager::ConnectionSettings::Ptr matched(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
+    matched->setUuid(QStringLiteral("00000000-0000-0000-0000-000000000003"));
+    NetworkManager::MatchSetting::Ptr match = matched->setting(NetworkManager::Setting::Match).staticCast<NetworkManager::MatchSetting>();
+    QVERIFY(match);
+    match->setInitialized(true);
+    match->setInterfaceName({QStringLiteral("eth*"), QStringLiteral("!eth0")});
+
+    QList<NetworkManager::DeviceMatcher::Candidate> devices;
+    for (int i = 0; i < 4; ++i) {
+        devices << NetworkManager::DeviceMatcher::Candidate{QStringLiteral("eth%1").arg(i), QString()};
+    }
+
+    const QHash<QString, QList<int>> mapping = NetworkManager::DeviceMatcher::devicesForConnections({any, bound, matched}, devices);
+    QCOMPARE(mapping.size(), 3);
+    QCOMPARE(mapping.value(any->uuid()), (QList<int>{0, 1, 2, 3}));
+    QCOMPARE(mapping.value(bound->uuid()), QList<int>{1});
+    QCOMPARE(mapping.value(matched->uuid()), (QList<int>{1, 2, 3}));
+}
+
+QTEST_MAIN(DeviceMatcherTest)
@@ -0,0 +1,23 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_DEVICE_MATCHER_TEST_H
+#define NETWORKMANAGERQT_DEVICE_MATCHER_TEST_H
+
+#include <QObject>
+
+class DeviceMatcherTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testPatterns_data();
+    void testPatterns();
+    void testDriver();
+    void testConnections();
+};
+
+#endif // NETWORKMANAGERQT_DEVICE_MATCHER_TEST_H
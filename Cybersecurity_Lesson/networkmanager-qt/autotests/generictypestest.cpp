@@ -0,0 +1,183 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "generictypestest.h"
+
+#include <QDBusMessage>
+#include <QDBusMetaType>
+#include <QTest>
+
+static const QString EchoPath = QStringLiteral("/org/kde/NetworkManagerQt/DataEcho");
+static const QString EchoInterface = QStringLiteral("org.kde.NetworkManagerQt.DataEcho");
+
+void GenericTypesTest::initTestCase()
+{
+    qDBusRegisterMetaType<NMVariantMapList>();
+    qDBusRegisterMetaType<NMAddressData>();
+    qDBusRegisterMetaType<NMAddressDataList>();
+    qDBusRegisterMetaType<NMRouteData>();
+    qDBusRegisterMetaType<NMRouteDataList>();
+
+    dataEcho = new DataEcho();
+    QVERIFY(QDBusConnection::sessionBus().registerObject(EchoPath, dataEcho, QDBusConnection::ExportAllSlots));
+
+    // a second connection, so every call really goes over the wire
+    client = QDBusConnection::connectToBus(QDBusConnection::SessionBus, QStringLiteral("generictypestest"));
+    QVERIFY(client.isConnected());
+}
+
+void GenericTypesTest::cleanupTestCase()
+{
+    QDBusConnection::disconnectFromBus(QStringLiteral("generictypestest"));
+    QDBusConnection::sessionBus().unregisterObject(EchoPath);
+    delete dataEcho;
+}
+
+QDBusArgument GenericTypesTest::echo(const QString &method, const NMVariantMapList &entries)
+{
+    QDBusMessage message = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(), EchoPath, EchoInterface, method);
+    message << QVariant::fromValue(entries);
+
+    const QDBusMessage reply = client.call(message, QDBus::BlockWithGui);
+    if (reply.type() != QDBusMessage::ReplyMessage || reply.arguments().size() != 1) {
+        qWarning() << reply.errorMessage();
+        return QDBusArgument();
+    }
+    return reply.arguments().constFirst().value<QDBusArgument>();
+}
+
+void GenericTypesTest::testAddressData()
+{
+    NMVariantMapList entries;
+    entries << QVariantMap{{QStringLiteral("address"), QStringLiteral("192.168.1.2")}, {QStringLiteral("prefix"), 24u}};
+    // attributes the demarshaller doesn't know about are skipped
+    entries << QVariantMap{{QStringLiteral("address"), QStringLiteral("10.0.0.2")},
+                           {QStringLiteral("prefix"), 8u},
+                           {QStringLiteral("label"), QStringLiteral("eth0:1")},
+                           {QStringLiteral("lifetime"), 3600u},
+                           {QStringLiteral("gateway"), QStringLiteral("10.0.0.1")}};
+    entries << QVariantMap{{QStringLiteral("address"), QStringLiteral("2001:db8::2")}, {QStringLiteral("prefix"), 64u}};
+    entries << QVariantMap();
+
+    const QDBusArgument argument = echo(QStringLiteral("addressData"), entries);
+    QCOMPARE(argument.currentSignature(), QStringLiteral("aa{sv}"));
+
+    // reading a copy leaves the position of the reply untouched, so it can be read twice
+    const NMAddressDataList addresses = qdbus_cast<NMAddressDataList>(QDBusArgument(argument));
+    QCOMPARE(addresses.size(), 4);
+
+    QCOMPARE(addresses.at(0).address, QStringLiteral("192.168.1.2"));
+    QVERIFY(addresses.at(0).hasPrefix);
+    QCOMPARE(addresses.at(0).prefix, 24u);
+    QVERIFY(addresses.at(0).gateway.isEmpty());
+
+    QCOMPARE(addresses.at(1).address, QStringLiteral("10.0.0.2"));
+    QCOMPARE(addresses.at(1).prefix, 8u);
+    QCOMPARE(addresses.at(1).gateway, QStringLiteral("10.0.0.1"));
+
+    QCOMPARE(addresses.at(2).address, QStringLiteral("2001:db8::2"));
+    QCOMPARE(addresses.at(2).prefix, 64u);
+
+    QVERIFY(addresses.at(3).address.isEmpty());
+    QVERIFY(!addresses.at(3).hasPrefix);
+    QCOMPARE(addresses.at(3).prefix, 0u);
+    QVERIFY(addresses.at(3).gateway.isEmpty());
+
+    // only the known keys went back over the wire
+    const NMVariantMapList maps = qdbus_cast<NMVariantMapList>(QDBusArgument(argument));
+    QCOMPARE(maps.size(), 4);
+    QCOMPARE(maps.at(1).keys(), (QStringList{QStringLiteral("address"), QStringLiteral("gateway"), QStringLiteral("prefix")}));
+    QCOMPARE(maps.at(3).keys(), QStringList{QStringLiteral("address")});
+}
+
+void GenericTypesTest::testRouteData()
+{
+    NMVariantMapList entries;
+    entries << QVariantMap{{QStringLiteral("dest"), QStringLiteral("10.0.0.0")},
+                           {QStringLiteral("prefix"), 8u},
+                           {QStringLiteral("next-hop"), QStringLiteral("192.168.1.1")},
+                           {QStringLiteral("metric"), 100u}};
+    // older daemons name the destination "address"
+    entries << QVariantMap{{QStringLiteral("address"), QStringLiteral("172.16.0.0")}, {QStringLiteral("prefix"), 12u}};
+    entries << QVariantMap{{QStringLiteral("dest"), QStringLiteral("2001:db8::")},
+                           {QStringLiteral("prefix"), 32u},
+                           {QStringLiteral("next-hop"), QStringLiteral("fe80::1")},
+                           {QStringLiteral("metric"), 0u},
+                           {QStringLiteral("table"), 254u},
+                           {QStringLiteral("onlink"), true}};
+    entries << QVariantMap();
+
+    const QDBusArgument argument = echo(QStringLiteral("routeData"), entries);
+    QCOMPARE(argument.currentSignature(), QStringLiteral("aa{sv}"));
+
+    const NMRouteDataList routes = qdbus_cast<NMRouteDataList>(QDBusArgument(argument));
+    QCOMPARE(routes.size(), 4);
+
+    QCOMPARE(routes.at(0).dest, QStringLiteral("10.0.0.0"));
+    QCOMPARE(routes.at(0).prefix, 8u);
+    QCOMPARE(routes.at(0).nextHop, QStringLiteral("192.168.1.1"));
+    QVERIFY(routes.at(0).hasMetric);
+    QCOMPARE(routes.at(0).metric, 100u);
+
+    QCOMPARE(routes.at(1).dest, QStringLiteral("172.16.0.0"));
+    QCOMPARE(routes.at(1).prefix, 12u);
+    QVERIFY(routes.at(1).nextHop.isEmpty());
+    QVERIFY(!routes.at(1).hasMetric);
+
+    QCOMPARE(routes.at(2).dest, QStringLiteral("2001:db8::"));
+    QCOMPARE(routes.at(2).prefix, 32u);
+    QCOMPARE(routes.at(2).nextHop, QStringLiteral("fe80::1"));
+    // a metric of 0 is a metric, not a missing one
+    QVERIFY(routes.at(2).hasMetric);
+    QCOMPARE(routes.at(2).metric, 0u);
+
+    QVERIFY(routes.at(3).dest.isEmpty());
+    QVERIFY(!routes.at(3).hasPrefix);
+    QVERIFY(!routes.at(3).hasMetric);
+
+    const NMVariantMapList maps = qdbus_cast<NMVariantMapList>(QDBusArgument(argument));
+    QCOMPARE(maps.size(), 4);
+    QCOMPARE(maps.at(1).keys(), (QStringList{QStringLiteral("dest"), QStringLiteral("prefix")}));
+    QCOMPARE(maps.at(2).keys(), (QStringList{QStringLiteral("dest"), QStringLiteral("metric"), QStringLiteral("next-hop"), QStringLiteral("prefix")}));
+}
+
+void GenericTypesTest::benchmarkAddressData_data()
+{
+    QTest::addColumn<bool>("typed");
+
+    QTest::newRow("NMAddressDataList") << true;
+    QTest::newRow("NMVariantMapList") << false;
+}
+
+// Decoding an AddressData property of a busy interface, typed against a QVariantMap per entry
+void GenericTypesTest::benchmarkAddressData()
+{
+    QFETCH(bool, typed);
+
+    NMVariantMapList entries;
+    for (int i = 0; i < 64; ++i) {
+        entries << QVariantMap{{QStringLiteral("address"), QStringLiteral("2001:db8::%1").arg(i, 0, 16)}, {QStringLiteral("prefix"), 64u}};
+    }
+    const QDBusArgument argument = echo(QStringLiteral("addressData"), entries);
+    QCOMPARE(qdbus_cast<NMAddressDataList>(QDBusArgument(argument)).size(), entries.size());
+
+    // every copy reads from its own position, the reply itself stays unread
+    if (typed) {
+        QBENCHMARK {
+            const QDBusArgument copy(argument);
+            const NMAddressDataList addresses = qdbus_cast<NMAddressDataList>(copy);
+            Q_UNUSED(addresses)
+        }
+    } else {
+        QBENCHMARK {
+            const QDBusArgument copy(argument);
+            const NMVariantMapList maps = qdbus_cast<NMVariantMapList>(copy);
+            Q_UNUSED(maps)
+        }
+    }
+}
+
+QTEST_MAIN(GenericTypesTest)
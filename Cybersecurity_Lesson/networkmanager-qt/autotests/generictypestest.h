@@ -0,0 +1,52 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_GENERICTYPES_TEST_H
+#define NETWORKMANAGERQT_GENERICTYPES_TEST_H
+
+#include <QDBusArgument>
+#include <QDBusConnection>
+#include <QObject>
+
+#include "generictypes.h"
+
+// Exported on the session bus, demarshals what it gets and marshals it straight back
+class DataEcho : public QObject
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", "org.kde.NetworkManagerQt.DataEcho")
+
+public Q_SLOTS:
+    NMAddressDataList addressData(const NMAddressDataList &data)
+    {
+        return data;
+    }
+    NMRouteDataList routeData(const NMRouteDataList &data)
+    {
+        return data;
+    }
+};
+
+class GenericTypesTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void testAddressData();
+    void testRouteData();
+    void benchmarkAddressData_data();
+    void benchmarkAddressData();
+
+private:
+    QDBusArgument echo(const QString &method, const NMVariantMapList &entries);
+
+    DataEcho *dataEcho = nullptr;
+    QDBusConnection client = QDBusConnection(QString());
+};
+
+#endif // NETWORKMANAGERQT_GENERICTYPES_TEST_H
@@ -0,0 +1,170 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "keyfiletest.h"
+
+#include "keyfile.h"
+#include "settings/ipv4setting.h"
+#include "settings/ipv6setting.h"
+#include "settings/wirelesssecuritysetting.h"
+#include "settings/wirelesssetting.h"
+
+#include <QTemporaryDir>
+#include <QTest>
+
+static const char wirelessKeyFile[] =
+    "# managed by a provisioning script\n"
+    "[connection]\n"
+    "id=Office\\sWiFi\n"
+    "uuid=0b6b0f50-7a2e-4d8e-9f7a-64b0c4f6d1a1\n"
+    "type=wifi\n"
+    "autoconnect=false\n"
+    "permissions=user:alice:;\n"
+    "\n"
+    "[wifi]\n"
+    "mode=infrastructure\n"
+    "ssid=Office\n"
+    "bssid=00:11:22:33:44:55\n"
+    "\n"
+    "[wifi-security]\n"
+    "key-mgmt=wpa-psk\n"
+    "psk=secret;key\n"
+    "\n"
+    "[ipv4]\n"
+    "method=manual\n"
+    "address1=192.168.1.10/24,192.168.1.1\n"
+    "route1=10.0.0.0/8,192.168.1.254,100\n"
+    "route1_options=onlink=true\n"
+    "dns=192.168.1.1;8.8.8.8;\n"
+    "dns-search=example.com;\n"
+    "\n"
+    "[ipv6]\n"
+    "method=auto\n";
+
+void KeyFileTest::testRead()
+{
+    NetworkManager::ConnectionSettings::Ptr settings = NetworkManager::keyFileToSettings(wirelessKeyFile);
+    QVERIFY(settings);
+
+    QCOMPARE(settings->id(), QStringLiteral("Office WiFi"));
+    QCOMPARE(settings->uuid(), QStringLiteral("0b6b0f50-7a2e-4d8e-9f7a-64b0c4f6d1a1"));
+    QCOMPARE(settings->connectionType(), NetworkManager::ConnectionSettings::Wireless);
+    QCOMPARE(settings->autoconnect(), false);
+    QCOMPARE(settings->permissions().value(QStringLiteral("alice")), QString());
+    QVERIFY(settings->permissions().contains(QStringLiteral("alice")));
+
+    NetworkManager::WirelessSetting::Ptr wirelessSetting = settings->setting(NetworkManager::Setting::Wireless).staticCast<NetworkManager::WirelessSetting>();
+    QCOMPARE(wirelessSetting->ssid(), QByteArray("Office"));
+    QCOMPARE(wirelessSetting->bssid(), QByteArray::fromHex("001122334455"));
+    QCOMPARE(wirelessSetting->mode(), NetworkManager::WirelessSetting::Infrastructure);
+
+    NetworkManager::WirelessSecuritySetting::Ptr securitySetting =
+        settings->setting(NetworkManager::Setting::WirelessSecurity).staticCast<NetworkManager::WirelessSecuritySetting>();
+    QCOMPARE(securitySetting->keyMgmt(), NetworkManager::WirelessSecuritySetting::WpaPsk);
+    QCOMPARE(securitySetting->psk(), QStringLiteral("secret;key"));
+
+    NetworkManager::Ipv4Setting::Ptr ipv4Setting = settings->setting(NetworkManager::Setting::Ipv4).staticCast<NetworkManager::Ipv4Setting>();
+    QCOMPARE(ipv4Setting->method(), NetworkManager::Ipv4Setting::Manual);
+    QCOMPARE(ipv4Setting->addresses().count(), 1);
+    QCOMPARE(ipv4Setting->addresses().at(0).ip(), QHostAddress(QStringLiteral("192.168.1.10")));
+    QCOMPARE(ipv4Setting->addresses().at(0).prefixLength(), 24);
+    QCOMPARE(ipv4Setting->addresses().at(0).gateway(), QHostAddress(QStringLiteral("192.168.1.1")));
+    QCOMPARE(ipv4Setting->routes().count(), 1);
+    QCOMPARE(ipv4Setting->routes().at(0).ip(), QHostAddress(QStringLiteral("10.0.0.0")));
+    QCOMPARE(ipv4Setting->routes().at(0).prefixLength(), 8);
+    QCOMPARE(ipv4Setting->routes().at(0).nextHop(), QHostAddress(QStringLiteral("192.168.1.254")));
+    QCOMPARE(ipv4Setting->routes().at(0).metric(), 100U);
+    QCOMPARE(ipv4Setting->dns(), QList<QHostAddress>({QHostAddress(QStringLiteral("192.168.1.1")), QHostAddress(QStringLiteral("8.8.8.8"))}));
+    QCOMPARE(ipv4Setting->dnsSearch(), QStringList{QStringLiteral("example.com")});
+
+    QVERIFY(!NetworkManager::keyFileToSettings("[wifi]\nssid=Office\n"));
+    QVERIFY(!NetworkManager::keyFileToSettings("[connection]\nnot a key\n"));
+}
+
+void KeyFileTest::testRoundTrip()
+{
+    NetworkManager::ConnectionSettings::Ptr settings = NetworkManager::keyFileToSettings(wirelessKeyFile);
+    QVERIFY(settings);
+
+    NetworkManager::WirelessSetting::Ptr wirelessSetting = settings->setting(NetworkManager::Setting::Wireless).staticCast<NetworkManager::WirelessSetting>();
+    wirelessSetting->setSsid(QByteArray("\x01;\xff", 3));
+
+    const QByteArray keyFile = NetworkManager::settingsToKeyFile(settings);
+    QVERIFY(keyFile.startsWith("[connection]\n"));
+    QVERIFY(keyFile.contains("\ntype=wifi\n"));
+    QVERIFY(keyFile.contains("\nssid=1;59;255;\n"));
+    QVERIFY(keyFile.contains("\naddress1=192.168.1.10/24,192.168.1.1\n"));
+
+    NetworkManager::ConnectionSettings::Ptr parsed = NetworkManager::keyFileToSettings(keyFile);
+    QVERIFY(parsed);
+    QCOMPARE(parsed->toMap(), settings->toMap());
+}
+
+void KeyFileTest::testDirectory()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    NetworkManager::ConnectionSettings::List list;
+    for (int i = 0; i < 16; ++i) {
+        NetworkManager::ConnectionSettings::Ptr settings(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
+        settings->setId(QStringLiteral("Wired %1").arg(i));
+        settings->setUuid(NetworkManager::ConnectionSettings::createNewUuid());
+        list << settings;
+    }
+
+    const QStringList fileNames = NetworkManager::writeKeyFiles(list, dir.path());
+    QCOMPARE(fileNames.count(), list.count());
+    QCOMPARE(QFile::permissions(fileNames.first()) & (QFileDevice::ReadOther | QFileDevice::ReadGroup), QFileDevice::Permissions());
+
+    QFile invalid(dir.filePath(QStringLiteral("invalid.nmconnection")));
+    QVERIFY(invalid.open(QIODevice::WriteOnly));
+    invalid.write("no group\n");
+    invalid.close();
+
+    const QMap<QString, NetworkManager::ConnectionSettings::Ptr> parsed = NetworkManager::readKeyFiles(dir.path());
+    QCOMPARE(parsed.count(), list.count() + 1);
+    QVERIFY(!parsed.value(invalid.fileName()));
+    for (int i = 0; i < list.count(); ++i) {
+        const NetworkManager::ConnectionSettings::Ptr settings = parsed.value(fileNames.at(i));
+        QVERIFY(settings);
+        QCOMPARE(settings->toMap(), list.at(i)->toMap());
+    }
+}
+
+void KeyFileTest::testWhitespace()
+{
+    const NetworkManager::ConnectionSettings::Ptr settings = NetworkManager::keyFileToSettings(
+        "  [connection]  \r\n"
+        "id = Trailing  \r\n"
+        "uuid=0b6b0f50-7a2e-4d8e-9f7a-64b0c4f6d1a2\n"
+        "type=wifi\n"
+        "[wifi]\n"
+        "ssid=Cafe \n");
+    QVERIFY(settings);
+    QCOMPARE(settings->id(), QStringLiteral("Trailing  "));
+
+    NetworkManager::WirelessSetting::Ptr wirelessSetting = settings->setting(NetworkManager::Setting::Wireless).staticCast<NetworkManager::WirelessSetting>();
+    QCOMPARE(wirelessSetting->ssid(), QByteArray("Cafe "));
+}
+
+void KeyFileTest::testEnumNick()
+{
+    const NetworkManager::ConnectionSettings::Ptr settings = NetworkManager::keyFileToSettings(
+        "[connection]\n"
+        "id=Wired\n"
+        "uuid=0b6b0f50-7a2e-4d8e-9f7a-64b0c4f6d1a3\n"
+        "type=ethernet\n"
+        "[ipv6]\n"
+        "method=auto\n"
+        "addr-gen-mode=stable-privacy\n");
+    QVERIFY(settings);
+
+    NetworkManager::Ipv6Setting::Ptr ipv6Setting = settings->setting(NetworkManager::Setting::Ipv6).staticCast<NetworkManager::Ipv6Setting>();
+    QCOMPARE(ipv6Setting->addressGenMode(), NetworkManager::Ipv6Setting::StablePrivacy);
+}
+
+QTEST_MAIN(KeyFileTest)
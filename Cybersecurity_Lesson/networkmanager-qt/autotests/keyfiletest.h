@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_KEYFILE_TEST_H
+#define NETWORKMANAGERQT_KEYFILE_TEST_H
+
+#include <QObject>
+
+class KeyFileTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testRead();
+    void testRoundTrip();
+    void testDirectory();
+    void testWhitespace();
+    void testEnumNick();
+};
+
+#endif // NETWORKMANAGERQT_KEYFILE_TEST_H
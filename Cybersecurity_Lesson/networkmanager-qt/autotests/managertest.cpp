@@ -152,4 +152,49 @@ void ManagerTest::testManager()
     fakeNetwork->setWwanEnabled(true);
 }
 
+void ManagerTest::testEventJournal()
+{
+    WiredDevice *device = new WiredDevice();
+    device->setDeviceType(1);
+    device->setInterface(QLatin1String("em2"));
+    device->setManaged(true);
+
+    const quint64 sequence = NetworkManager::eventJournalSequence();
+
+    QSignalSpy addDeviceSpy(NetworkManager::notifier(), SIGNAL(deviceAdded(QString)));
+    fakeNetwork->addDevice(device);
+    QVERIFY(addDeviceSpy.wait());
+    const QString addedDevicePath = addDeviceSpy.at(0).at(0).toString();
+
+    QSignalSpy removeDeviceSpy(NetworkManager::notifier(), SIGNAL(deviceRemoved(QString)));
+    fakeNetwork->removeDevice(device);
+    QVERIFY(removeDeviceSpy.wait());
+
+    QList<NetworkManager::JournalEvent> events;
+    QVERIFY(NetworkManager::eventsSince(sequence, events));
+    QCOMPARE(events.count(), 2);
+    QCOMPARE(events.at(0).sequence, sequence + 1);
+    QCOMPARE(events.at(0).type, NetworkManager::JournalEvent::DeviceAdded);
+    QCOMPARE(events.at(0).uni, addedDevicePath);
+    QCOMPARE(events.at(1).sequence, sequence + 2);
+    QCOMPARE(events.at(1).type, NetworkManager::JournalEvent::DeviceRemoved);
+    QCOMPARE(events.at(1).uni, addedDevicePath);
+    QCOMPARE(NetworkManager::eventJournalSequence(), sequence + 2);
+
+    // Nothing new since the last entry
+    QVERIFY(NetworkManager::eventsSince(sequence + 2, events));
+    QVERIFY(events.isEmpty());
+
+    // Shrinking the journal drops the oldest entries and forces a rescan
+    const int capacity = NetworkManager::eventJournalCapacity();
+    NetworkManager::setEventJournalCapacity(1);
+    QVERIFY(!NetworkManager::eventsSince(sequence, events));
+    QVERIFY(NetworkManager::eventsSince(sequence + 1, events));
+    QCOMPARE(events.count(), 1);
+    QCOMPARE(events.at(0).type, NetworkManager::JournalEvent::DeviceRemoved);
+    NetworkManager::setEventJournalCapacity(capacity);
+
+    delete device;
+}
+
 QTEST_MAIN(ManagerTest)
@@ -20,6 +20,7 @@ private Q_SLOTS:
     void testDevices();
     void testDeviceAdded(const QString &dev);
     void testManager();
+    void testEventJournal();
 
 private:
     FakeNetwork *fakeNetwork;
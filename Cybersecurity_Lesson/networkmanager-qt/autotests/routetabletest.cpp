@@ -0,0 +1,186 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "routetabletest.h"
+
+#include "routetable.h"
+
+#include <QSignalSpy>
+#include <QTest>
+
+static NetworkManager::IpAddress address(const QString &ip, int prefixLength, const QString &gateway = QString())
+{
+    NetworkManager::IpAddress address;
+    address.setIp(QHostAddress(ip));
+    address.setPrefixLength(prefixLength);
+    if (!gateway.isEmpty()) {
+        address.setGateway(QHostAddress(gateway));
+    }
+    return address;
+}
+
+static NetworkManager::IpRoute route(const QString &destination, int prefixLength, const QString &nextHop, quint32 metric)
+{
+    NetworkManager::IpRoute route;
+    route.setIp(QHostAddress(destination));
+    route.setPrefixLength(prefixLength);
+    route.setNextHop(QHostAddress(nextHop));
+    route.setMetric(metric);
+    return route;
+}
+
+static NetworkManager::IpConfig config(const NetworkManager::IpAddresses &addresses, const NetworkManager::IpRoutes &routes = NetworkManager::IpRoutes())
+{
+    return NetworkManager::IpConfig(addresses, QList<QHostAddress>(), QStringList(), routes);
+}
+
+static void populate(NetworkManager::RouteTable &table)
+{
+    // eth0 has the default route and a static route into the lab network
+    table.setRoutes(QStringLiteral("/dev/eth0"),
+                    QStringLiteral("eth0"),
+                    config({address(QStringLiteral("192.168.1.10"), 24, QStringLiteral("192.168.1.1"))},
+                           {route(QStringLiteral("10.0.0.0"), 8, QStringLiteral("192.168.1.254"), 100)}),
+                    config({address(QStringLiteral("2001:db8:1::10"), 64, QStringLiteral("fe80::1"))}));
+    // the lab bridge is more specific than the static route and has a better metric for a /16
+    table.setRoutes(QStringLiteral("/dev/br0"),
+                    QStringLiteral("br0"),
+                    config({address(QStringLiteral("10.20.30.1"), 24)},
+                           {route(QStringLiteral("10.20.0.0"), 16, QStringLiteral("10.20.30.254"), 50),
+                            route(QStringLiteral("10.0.0.0"), 8, QStringLiteral("10.20.30.253"), 10)}),
+                    NetworkManager::IpConfig());
+}
+
+void RouteTableTest::testLookup_data()
+{
+    QTest::addColumn<QString>("destination");
+    QTest::addColumn<QString>("interfaceName");
+    QTest::addColumn<QString>("nextHop");
+    QTest::addColumn<int>("prefixLength");
+
+    QTest::newRow("connected") << QStringLiteral("192.168.1.77") << QStringLiteral("eth0") << QString() << 24;
+    QTest::newRow("default") << QStringLiteral("8.8.8.8") << QStringLiteral("eth0") << QStringLiteral("192.168.1.1") << 0;
+    QTest::newRow("lower metric") << QStringLiteral("10.1.2.3") << QStringLiteral("br0") << QStringLiteral("10.20.30.253") << 8;
+    QTest::newRow("static") << QStringLiteral("10.20.99.1") << QStringLiteral("br0") << QStringLiteral("10.20.30.254") << 16;
+    QTest::newRow("bridge") << QStringLiteral("10.20.30.40") << QStringLiteral("br0") << QString() << 24;
+    QTest::newRow("ipv6 connected") << QStringLiteral("2001:db8:1::99") << QStringLiteral("eth0") << QString() << 64;
+    QTest::newRow("ipv6 default") << QStringLiteral("2606:4700::1111") << QStringLiteral("eth0") << QStringLiteral("fe80::1") << 0;
+}
+
+void RouteTableTest::testLookup()
+{
+    QFETCH(QString, destination);
+    QFETCH(QString, interfaceName);
+    QFETCH(QString, nextHop);
+    QFETCH(int, prefixLength);
+
+    NetworkManager::RouteTable table(NetworkManager::RouteTable::Manual);
+    populate(table);
+    QCOMPARE(table.devices().size(), 2);
+
+    const NetworkManager::RouteTable::Match match = table.lookup(QHostAddress(destination));
+    QVERIFY(match.isValid());
+    QCOMPARE(match.interfaceName, interfaceName);
+    QCOMPARE(int(match.route.prefixLength), prefixLength);
+    if (nextHop.isEmpty()) {
+        QVERIFY(!match.route.nextHop.isValid() || match.route.nextHop.isUnspecified());
+    } else {
+        QCOMPARE(match.route.nextHop.toString(), nextHop);
+    }
+}
+
+void RouteTableTest::testUpdate()
+{
+    NetworkManager::RouteTable table(NetworkManager::RouteTable::Manual);
+    QSignalSpy changedSpy(&table, &NetworkManager::RouteTable::routesChanged);
+    populate(table);
+    QCOMPARE(changedSpy.count(), 2);
+    const int count = table.count();
+
+    // replacing the bridge routes must leave those of eth0 alone
+    table.setRoutes(QStringLiteral("/dev/br0"), QStringLiteral("br0"), config({address(QStringLiteral("10.20.30.1"), 24)}), NetworkManager::IpConfig());
+    QCOMPARE(table.count(), count - 2);
+    QCOMPARE(table.lookup(QHostAddress(QStringLiteral("10.20.99.1"))).route.nextHop.toString(), QStringLiteral("192.168.1.254"));
+    QCOMPARE(table.lookup(QHostAddress(QStringLiteral("10.20.30.40"))).interfaceName, QStringLiteral("br0"));
+
+    table.removeRoutes(QStringLiteral("/dev/eth0"));
+    QCOMPARE(table.devices(), QStringList{QStringLiteral("/dev/br0")});
+    QVERIFY(!table.lookup(QHostAddress(QStringLiteral("8.8.8.8"))).isValid());
+    QVERIFY(!table.lookup(QHostAddress(QStringLiteral("2001:db8:1::99"))).isValid());
+
+    // enough churn to make the table drop its unused nodes
+    for (int i = 0; i < 200; ++i) {
+        const QString ip = QStringLiteral("172.16.%1.1").arg(i);
+        table.setRoutes(QStringLiteral("/dev/veth"), QStringLiteral("veth"), config({address(ip, 30)}), NetworkManager::IpConfig());
+        QCOMPARE(table.lookup(QHostAddress(ip)).interfaceName, QStringLiteral("veth"));
+    }
+    QCOMPARE(table.lookup(QHostAddress(QStringLiteral("10.20.30.40"))).interfaceName, QStringLiteral("br0"));
+    QVERIFY(!table.lookup(QHostAddress(QStringLiteral("172.16.3.1"))).isValid());
+
+    table.clear();
+    QCOMPARE(table.count(), 0);
+    QVERIFY(table.devices().isEmpty());
+}
+
+void RouteTableTest::testBatch()
+{
+    NetworkManager::RouteTable table(NetworkManager::RouteTable::Manual);
+    populate(table);
+
+    QList<QHostAddress> destinations;
+    for (int i = 0; i < 1000; ++i) {
+        destinations << QHostAddress(QStringLiteral("10.20.%1.%2").arg(i % 64).arg(i % 250 + 1));
+    }
+    destinations << QHostAddress();
+
+    const QList<NetworkManager::RouteTable::Match> matches = table.lookup(destinations);
+    QCOMPARE(matches.size(), destinations.size());
+    for (int i = 0; i < destinations.size() - 1; ++i) {
+        QCOMPARE(matches.at(i).interfaceName, QStringLiteral("br0"));
+        QCOMPARE(int(matches.at(i).route.prefixLength), i % 64 == 30 ? 24 : 16);
+    }
+    QVERIFY(!matches.constLast().isValid());
+}
+
+void RouteTableTest::testMetric()
+{
+    NetworkManager::RouteTable table(NetworkManager::RouteTable::Manual);
+
+    // eth0 reports its subnet and default route, wlan0 in the same network only its address
+    auto setEthernet = [&table](quint32 metric) {
+        table.setRoutes(QStringLiteral("/dev/eth0"),
+                        QStringLiteral("eth0"),
+                        config({address(QStringLiteral("192.168.1.10"), 24, QStringLiteral("192.168.1.1"))},
+                               {route(QStringLiteral("0.0.0.0"), 0, QStringLiteral("192.168.1.1"), metric),
+                                route(QStringLiteral("192.168.1.0"), 24, QStringLiteral("0.0.0.0"), metric)}),
+                        NetworkManager::IpConfig(),
+                        100);
+    };
+    setEthernet(100);
+    table.setRoutes(QStringLiteral("/dev/wlan0"),
+                    QStringLiteral("wlan0"),
+                    config({address(QStringLiteral("192.168.1.50"), 24, QStringLiteral("192.168.1.1"))}),
+                    NetworkManager::IpConfig(),
+                    600);
+    // the reported routes aren't duplicated by derived ones
+    QCOMPARE(table.count(), 4);
+
+    NetworkManager::RouteTable::Match match = table.lookup(QHostAddress(QStringLiteral("8.8.8.8")));
+    QCOMPARE(match.interfaceName, QStringLiteral("eth0"));
+    QCOMPARE(match.route.metric, 100U);
+    match = table.lookup(QHostAddress(QStringLiteral("192.168.1.77")));
+    QCOMPARE(match.interfaceName, QStringLiteral("eth0"));
+    QCOMPARE(match.route.metric, 100U);
+
+    setEthernet(700);
+    QCOMPARE(table.count(), 4);
+    match = table.lookup(QHostAddress(QStringLiteral("8.8.8.8")));
+    QCOMPARE(match.interfaceName, QStringLiteral("wlan0"));
+    QCOMPARE(match.route.metric, 600U);
+    QCOMPARE(match.route.nextHop.toString(), QStringLiteral("192.168.1.1"));
+}
+
+QTEST_MAIN(RouteTableTest)
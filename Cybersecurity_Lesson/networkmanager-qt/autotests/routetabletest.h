@@ -0,0 +1,24 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_ROUTE_TABLE_TEST_H
+#define NETWORKMANAGERQT_ROUTE_TABLE_TEST_H
+
+#include <QObject>
+
+class RouteTableTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testLookup_data();
+    void testLookup();
+    void testUpdate();
+    void testBatch();
+    void testMetric();
+};
+
+#endif // NETWORKMANAGERQT_ROUTE_TABLE_TEST_H
@@ -10,6 +10,7 @@
 
 #include <libnm/NetworkManager.h>
 
+#include <QSet>
 #include <QTest>
 
 void Security8021xSettingTest::testSetting_data()
@@ -178,4 +179,29 @@ void Security8021xSettingTest::testSetting()
     }
 }
 
+void Security8021xSettingTest::testCertificateSharing()
+{
+    const QByteArray certificate = QByteArray("-----BEGIN CERTIFICATE-----\n") + QByteArray(4096, 'x') + QByteArray("\n-----END CERTIFICATE-----\n");
+
+    // 500 profiles each reading their own copy of the same CA certificate
+    QList<NetworkManager::Security8021xSetting::Ptr> settings;
+    QSet<const char *> blobs;
+    for (int i = 0; i < 500; ++i) {
+        QVariantMap map;
+        map.insert(QLatin1String(NM_SETTING_802_1X_CA_CERT), QByteArray(certificate.constData(), certificate.size()));
+        NetworkManager::Security8021xSetting::Ptr setting(new NetworkManager::Security8021xSetting());
+        setting->fromMap(map);
+        settings << setting;
+        blobs.insert(setting->caCertificate().constData());
+    }
+
+    QCOMPARE(settings.first()->caCertificate(), certificate);
+    QCOMPARE(blobs.count(), 1);
+
+    // a different certificate gets its own blob
+    settings.first()->setPhase2CaCertificate(certificate + "other");
+    QVERIFY(settings.first()->phase2CaCertificate().constData() != settings.first()->caCertificate().constData());
+    QCOMPARE(settings.first()->phase2CaCertificate(), certificate + "other");
+}
+
 QTEST_MAIN(Security8021xSettingTest)
@@ -16,6 +16,7 @@ class Security8021xSettingTest : public QObject
 private Q_SLOTS:
     void testSetting_data();
     void testSetting();
+    void testCertificateSharing();
 };
 
 #endif // NETWORKMANAGERQT_SECURITY8021XSETTING_TEST_H
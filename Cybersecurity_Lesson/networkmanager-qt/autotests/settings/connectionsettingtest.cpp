@@ -7,6 +7,9 @@
 #include "connectionsettingtest.h"
 
 #include "settings/connectionsettings.h"
+#include "settings/ipv4setting.h"
+#include "settings/ipv6setting.h"
+#include "settings/wiredsetting.h"
 
 #include <libnm/NetworkManager.h>
 
@@ -117,4 +120,67 @@ void ConnectionSettingTest::testSetting()
     }
 }
 
+void ConnectionSettingTest::testImplicitSharing()
+{
+    NetworkManager::ConnectionSettings::Ptr settings(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
+    settings->setId(QStringLiteral("wired"));
+
+    NetworkManager::ConnectionSettings::Ptr copy(new NetworkManager::ConnectionSettings(settings));
+    QCOMPARE(copy->toMap(), settings->toMap());
+    QCOMPARE(copy->settings().count(), settings->settings().count());
+
+    copy->setId(QStringLiteral("copy"));
+    QCOMPARE(settings->id(), QStringLiteral("wired"));
+    QCOMPARE(copy->id(), QStringLiteral("copy"));
+
+    // editing one section of the copy leaves the original alone
+    NetworkManager::WiredSetting::Ptr copyWired = copy->setting(NetworkManager::Setting::Wired).staticCast<NetworkManager::WiredSetting>();
+    NetworkManager::WiredSetting::Ptr wired = settings->setting(NetworkManager::Setting::Wired).staticCast<NetworkManager::WiredSetting>();
+    QVERIFY(copyWired != wired);
+    copyWired->setMtu(1400);
+    QCOMPARE(copyWired->mtu(), quint32(1400));
+    QCOMPARE(wired->mtu(), quint32(0));
+
+    const NMVariantMapMap original = settings->toMap();
+    QVariantMap ipv4;
+    ipv4.insert(QLatin1String(NMQT_SETTING_IP4_CONFIG_METHOD), QLatin1String(NMQT_SETTING_IP4_CONFIG_METHOD_MANUAL));
+    copy->setting(NetworkManager::Setting::Ipv4)->fromMap(ipv4);
+    QCOMPARE(settings->toMap(), original);
+    QCOMPARE(settings->setting(NetworkManager::Setting::Ipv4).staticCast<NetworkManager::Ipv4Setting>()->method(),
+             NetworkManager::Ipv4Setting::Automatic);
+    QCOMPARE(copy->setting(NetworkManager::Setting::Ipv4).staticCast<NetworkManager::Ipv4Setting>()->method(),
+             NetworkManager::Ipv4Setting::Manual);
+}
+
+void ConnectionSettingTest::testDiffUnchangedIpv6()
+{
+    auto ipv6Settings = [](quint32 metric) {
+        NetworkManager::IpAddress address;
+        address.setIp(QHostAddress(QStringLiteral("2001:db8::2")));
+        address.setPrefixLength(64);
+        address.setGateway(QHostAddress(QStringLiteral("2001:db8::1")));
+
+        NetworkManager::IpRoute route;
+        route.setIp(QHostAddress(QStringLiteral("2001:db8:1::")));
+        route.setPrefixLength(48);
+        route.setNextHop(QHostAddress(QStringLiteral("2001:db8::1")));
+        route.setMetric(metric);
+
+        NetworkManager::ConnectionSettings settings(NetworkManager::ConnectionSettings::Wired);
+        NetworkManager::Ipv6Setting::Ptr ipv6 = settings.setting(NetworkManager::Setting::Ipv6).staticCast<NetworkManager::Ipv6Setting>();
+        ipv6->setInitialized(true);
+        ipv6->setMethod(NetworkManager::Ipv6Setting::Manual);
+        ipv6->setAddresses({address});
+        ipv6->setRoutes({route});
+        return settings.toMap();
+    };
+
+    // equal addresses and routes in different list objects are no change
+    QVERIFY(NetworkManager::ConnectionSettings::diff(ipv6Settings(100), ipv6Settings(100)).isEmpty());
+
+    const NMVariantMapMap changes = NetworkManager::ConnectionSettings::diff(ipv6Settings(100), ipv6Settings(200));
+    QCOMPARE(changes.keys(), QStringList{QLatin1String(NM_SETTING_IP6_CONFIG_SETTING_NAME)});
+    QCOMPARE(changes.first().keys(), QStringList{QLatin1String(NMQT_SETTING_IP6_CONFIG_ROUTES)});
+}
+
 QTEST_MAIN(ConnectionSettingTest)
@@ -16,6 +16,8 @@ class ConnectionSettingTest : public QObject
 private Q_SLOTS:
     void testSetting_data();
     void testSetting();
+    void testImplicitSharing();
+    void testDiffUnchangedIpv6();
 };
 
 #endif // NETWORKMANAGERQT_CONNECTIONSETTING_TEST_H
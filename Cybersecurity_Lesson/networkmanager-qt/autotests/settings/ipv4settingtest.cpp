@@ -180,4 +180,57 @@ void IPv4SettingTest::testSetting()
              qdbus_cast<NMVariantMapList>(map1.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTE_DATA))));
 }
 
+void IPv4SettingTest::testImplicitSharing()
+{
+    NetworkManager::Ipv4Setting::Ptr setting(new NetworkManager::Ipv4Setting());
+    setting->setMethod(NetworkManager::Ipv4Setting::Manual);
+    setting->setDhcpHostname(QStringLiteral("host"));
+
+    NetworkManager::Ipv4Setting::Ptr copy(new NetworkManager::Ipv4Setting(setting));
+    QCOMPARE(copy->toMap(), setting->toMap());
+    QCOMPARE(copy->type(), NetworkManager::Setting::Ipv4);
+
+    // modifying the copy must not leak back into the original
+    copy->setDhcpHostname(QStringLiteral("other"));
+    copy->setInitialized(true);
+    QCOMPARE(setting->dhcpHostname(), QStringLiteral("host"));
+    QCOMPARE(copy->dhcpHostname(), QStringLiteral("other"));
+    QVERIFY(setting->isNull());
+    QVERIFY(!copy->isNull());
+    QCOMPARE(copy->method(), NetworkManager::Ipv4Setting::Manual);
+}
+
+void IPv4SettingTest::testInvalidEntries()
+{
+    UIntListList addresses;
+    addresses << UIntList{inet_addr("192.168.1.2"), 24, inet_addr("192.168.1.1")};
+    addresses << UIntList{inet_addr("192.168.1.3"), 24}; // too short
+    addresses << UIntList{inet_addr("192.168.1.4"), 33, inet_addr("192.168.1.1")}; // prefix out of range
+
+    UIntListList routes;
+    routes << UIntList{inet_addr("10.0.0.0"), 8, inet_addr("192.168.1.1"), 25};
+    routes << UIntList{inet_addr("10.1.0.0"), 16, inet_addr("192.168.1.1")}; // no metric
+    routes << UIntList{inet_addr("10.2.0.0"), 40, inet_addr("192.168.1.1"), 25}; // prefix out of range
+
+    QVariantMap map;
+    map.insert(QLatin1String(NMQT_SETTING_IP4_CONFIG_ADDRESSES), QVariant::fromValue(addresses));
+    map.insert(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTES), QVariant::fromValue(routes));
+
+    NetworkManager::Ipv4Setting setting;
+    setting.fromMap(map);
+
+    const QList<NetworkManager::IpAddress> decodedAddresses = setting.addresses();
+    QCOMPARE(decodedAddresses.size(), 1);
+    QVERIFY(decodedAddresses.at(0).isValid());
+    QCOMPARE(decodedAddresses.at(0).ip(), QHostAddress(QStringLiteral("192.168.1.2")));
+    QCOMPARE(decodedAddresses.at(0).prefixLength(), 24);
+    QCOMPARE(decodedAddresses.at(0).gateway(), QHostAddress(QStringLiteral("192.168.1.1")));
+
+    const QList<NetworkManager::IpRoute> decodedRoutes = setting.routes();
+    QCOMPARE(decodedRoutes.size(), 1);
+    QVERIFY(decodedRoutes.at(0).isValid());
+    QCOMPARE(decodedRoutes.at(0).ip(), QHostAddress(QStringLiteral("10.0.0.0")));
+    QCOMPARE(decodedRoutes.at(0).metric(), 25u);
+}
+
 QTEST_MAIN(IPv4SettingTest)
@@ -16,6 +16,8 @@ class IPv4SettingTest : public QObject
 private Q_SLOTS:
     void testSetting_data();
     void testSetting();
+    void testImplicitSharing();
+    void testInvalidEntries();
 };
 
 #endif // NETWORKMANAGERQT_IPV4SETTING_TEST_H
@@ -16,20 +16,28 @@
 #define NM_SETTING_MATCH_INTERFACE_NAME "interface-name"
 #endif
 
+#if !NM_CHECK_VERSION(1, 26, 0)
+#define NM_SETTING_MATCH_DRIVER "driver"
+#endif
+
 void MatchSettingTest::testSetting_data()
 {
     QTest::addColumn<QStringList>("interfaceName");
+    QTest::addColumn<QStringList>("driver");
 
-    QTest::newRow("setting1") << QStringList{QString("name1"), QString("name2")}; // interfaceName
+    QTest::newRow("setting1") << QStringList{QString("name1"), QString("name2")} // interfaceName
+                              << QStringList{QString("e1000*"), QString("!r8169")}; // driver
 }
 
 void MatchSettingTest::testSetting()
 {
     QFETCH(QStringList, interfaceName);
+    QFETCH(QStringList, driver);
 
     QVariantMap map;
 
     map.insert(QLatin1String(NM_SETTING_MATCH_INTERFACE_NAME), interfaceName);
+    map.insert(QLatin1String(NM_SETTING_MATCH_DRIVER), driver);
 
     NetworkManager::MatchSetting setting;
     setting.fromMap(map);
@@ -6,6 +6,7 @@
 
 #include "settingstest.h"
 
+#include "connectionimport.h"
 #include "settings.h"
 #include "settings/ipv4setting.h"
 #include "settings/ipv6setting.h"
@@ -78,9 +79,67 @@ void SettingsTest::testConnectionAdded(const QString &connection)
 
     addedConnection->update(connectionSettings->toMap());
     QSignalSpy connectionUpdatedSpy(addedConnection.data(), SIGNAL(updated()));
+    QSignalSpy settingsChangedSpy(addedConnection.data(), SIGNAL(settingsChanged(QStringList)));
     QVERIFY(connectionUpdatedSpy.wait());
+    QCOMPARE(settingsChangedSpy.count(), 1);
     QVERIFY(wiredSetting->speed() == 10);
     QVERIFY(wiredSetting->duplexType() == NetworkManager::WiredSetting::Half);
+    QVERIFY(settingsChangedSpy.at(0).at(0).toStringList().contains(QLatin1String(NM_SETTING_WIRED_SETTING_NAME)));
+
+    // Only the wired setting differs, everything else is sent back as the daemon has it
+    connectionSettings = addedConnection->settings();
+    wiredSetting = connectionSettings->setting(NetworkManager::Setting::Wired).dynamicCast<NetworkManager::WiredSetting>();
+    wiredSetting->setSpeed(1000);
+    addedConnection->updateChanged(connectionSettings);
+    QVERIFY(connectionUpdatedSpy.wait());
+    QCOMPARE(settingsChangedSpy.count(), 2);
+    QCOMPARE(settingsChangedSpy.at(1).at(0).toStringList(), QStringList{QLatin1String(NM_SETTING_WIRED_SETTING_NAME)});
+    QCOMPARE(addedConnection->settings()->setting(NetworkManager::Setting::Wired).dynamicCast<NetworkManager::WiredSetting>()->speed(), 1000U);
+
+    // Nothing changed, so nothing is sent
+    QDBusPendingReply<QVariantMap> reply = addedConnection->updateChanged(addedConnection->settings());
+    QVERIFY(reply.isFinished());
+    QVERIFY(!reply.isError());
+}
+
+void SettingsTest::testImport()
+{
+    // testConnectionAdded() expects a single specific connection
+    disconnect(NetworkManager::settingsNotifier(), &NetworkManager::SettingsNotifier::connectionAdded, this, &SettingsTest::testConnectionAdded);
+
+    NetworkManager::ConnectionSettings::List list;
+    for (int i = 0; i < 5; ++i) {
+        NetworkManager::ConnectionSettings::Ptr connectionSettings(new NetworkManager::ConnectionSettings(NetworkManager::ConnectionSettings::Wired));
+        connectionSettings->setId(QStringLiteral("Imported connection %1").arg(i));
+        connectionSettings->setUuid(NetworkManager::ConnectionSettings::createNewUuid());
+        list << connectionSettings;
+    }
+
+    NetworkManager::ConnectionImport import(list);
+    import.setMaxInFlight(2);
+    QSignalSpy progressSpy(&import, &NetworkManager::ConnectionImport::progress);
+    QSignalSpy finishedSpy(&import, &NetworkManager::ConnectionImport::finished);
+    import.start();
+    QVERIFY(finishedSpy.wait());
+
+    QVERIFY(import.isFinished());
+    QCOMPARE(import.completedCount(), list.count());
+    QCOMPARE(import.failedCount(), 0);
+    QCOMPARE(progressSpy.count(), list.count());
+    QCOMPARE(progressSpy.last().at(0).toInt(), list.count());
+    QVERIFY(import.elapsed() >= 0);
+
+    const QList<NetworkManager::ConnectionImport::Result> results = import.results();
+    QCOMPARE(results.count(), list.count());
+    QStringList paths;
+    for (const NetworkManager::ConnectionImport::Result &result : results) {
+        QVERIFY(!result.path.isEmpty());
+        QVERIFY(result.error.isEmpty());
+        QVERIFY(result.latency >= 0);
+        paths << result.path;
+    }
+    paths.removeDuplicates();
+    QCOMPARE(paths.count(), list.count());
 }
 
 QTEST_MAIN(SettingsTest)
@@ -19,6 +19,7 @@ private Q_SLOTS:
     void initTestCase();
     void testConnections();
     void testConnectionAdded(const QString &connection);
+    void testImport();
 
 private:
     FakeNetwork *fakeNetwork;
@@ -21,9 +21,9 @@ NetworkManager::AccessPointPrivate::AccessPointPrivate(const QString &path, Acce
     , capabilities(AccessPoint::None)
     , wpaFlags()
     , rsnFlags()
+    , mode(AccessPoint::Unknown)
     , frequency(0)
     , maxBitRate(0)
-    , mode(AccessPoint::Unknown)
     , signalStrength(0)
     , lastSeen(-1)
     , q_ptr(q)
@@ -64,6 +64,10 @@ NetworkManager::AccessPoint::AccessPoint(const QString &path, QObject *parent)
                                          QLatin1String("PropertiesChanged"),
                                          d,
                                          SLOT(dbusPropertiesChanged(QString, QVariantMap, QStringList)));
+
+#ifdef NMQT_STATIC
+    connect(&d->iface, &OrgFreedesktopNetworkManagerAccessPointInterface::PropertiesChanged, d, &AccessPointPrivate::propertiesChanged);
+#endif
 }
 
 NetworkManager::AccessPoint::~AccessPoint()
@@ -108,6 +112,12 @@ QString NetworkManager::AccessPoint::ssid() const
     return d->ssid;
 }
 
+QBindable<QString> NetworkManager::AccessPoint::bindableSsid()
+{
+    Q_D(AccessPoint);
+    return &d->ssid;
+}
+
 QByteArray NetworkManager::AccessPoint::rawSsid() const
 {
     Q_D(const AccessPoint);
@@ -120,12 +130,24 @@ uint NetworkManager::AccessPoint::frequency() const
     return d->frequency;
 }
 
+QBindable<uint> NetworkManager::AccessPoint::bindableFrequency()
+{
+    Q_D(AccessPoint);
+    return &d->frequency;
+}
+
 uint NetworkManager::AccessPoint::maxBitRate() const
 {
     Q_D(const AccessPoint);
     return d->maxBitRate;
 }
 
+QBindable<uint> NetworkManager::AccessPoint::bindableMaxBitRate()
+{
+    Q_D(AccessPoint);
+    return &d->maxBitRate;
+}
+
 NetworkManager::AccessPoint::OperationMode NetworkManager::AccessPoint::mode() const
 {
     Q_D(const AccessPoint);
@@ -138,12 +160,24 @@ int NetworkManager::AccessPoint::signalStrength() const
     return d->signalStrength;
 }
 
+QBindable<int> NetworkManager::AccessPoint::bindableSignalStrength()
+{
+    Q_D(AccessPoint);
+    return &d->signalStrength;
+}
+
 int NetworkManager::AccessPoint::lastSeen() const
 {
     Q_D(const AccessPoint);
     return d->lastSeen;
 }
 
+QBindable<int> NetworkManager::AccessPoint::bindableLastSeen()
+{
+    Q_D(AccessPoint);
+    return &d->lastSeen;
+}
+
 NetworkManager::AccessPoint::OperationMode NetworkManager::AccessPoint::convertOperationMode(uint mode)
 {
     NetworkManager::AccessPoint::OperationMode ourMode = NetworkManager::AccessPoint::Unknown;
@@ -197,23 +231,23 @@ void NetworkManager::AccessPointPrivate::propertiesChanged(const QVariantMap &pr
         } else if (property == QLatin1String("Ssid")) {
             rawSsid = it->toByteArray();
             ssid = QString::fromUtf8(rawSsid);
-            Q_EMIT q->ssidChanged(ssid);
+            Q_EMIT q->ssidChanged(ssid.value());
         } else if (property == QLatin1String("Frequency")) {
             frequency = it->toUInt();
-            Q_EMIT q->frequencyChanged(frequency);
+            Q_EMIT q->frequencyChanged(frequency.value());
         } else if (property == QLatin1String("HwAddress")) {
             hardwareAddress = it->toString();
         } else if (property == QLatin1String("Mode")) {
             mode = q->convertOperationMode(it->toUInt());
         } else if (property == QLatin1String("MaxBitrate")) {
             maxBitRate = it->toUInt();
-            Q_EMIT q->bitRateChanged(maxBitRate);
+            Q_EMIT q->bitRateChanged(maxBitRate.value());
         } else if (property == QLatin1String("Strength")) {
             signalStrength = it->toInt();
-            Q_EMIT q->signalStrengthChanged(signalStrength);
+            Q_EMIT q->signalStrengthChanged(signalStrength.value());
         } else if (property == QLatin1String("LastSeen")) {
             lastSeen = it->toInt();
-            Q_EMIT q->lastSeenChanged(lastSeen);
+            Q_EMIT q->lastSeenChanged(lastSeen.value());
         } else {
             qCDebug(NMQT) << Q_FUNC_INFO << "Unhandled property" << property;
         }
@@ -14,6 +14,7 @@
 #include <nm-version.h>
 
 #include <QObject>
+#include <QProperty>
 #include <QSharedPointer>
 #include <QVariantMap>
 
@@ -27,6 +28,13 @@ class AccessPointPrivate;
 class NETWORKMANAGERQT_EXPORT AccessPoint : public QObject
 {
     Q_OBJECT
+
+    Q_PROPERTY(QString ssid READ ssid NOTIFY ssidChanged BINDABLE bindableSsid)
+    Q_PROPERTY(uint frequency READ frequency NOTIFY frequencyChanged BINDABLE bindableFrequency)
+    Q_PROPERTY(uint maxBitRate READ maxBitRate NOTIFY bitRateChanged BINDABLE bindableMaxBitRate)
+    Q_PROPERTY(int signalStrength READ signalStrength NOTIFY signalStrengthChanged BINDABLE bindableSignalStrength)
+    Q_PROPERTY(int lastSeen READ lastSeen NOTIFY lastSeenChanged BINDABLE bindableLastSeen)
+
 public:
     typedef QSharedPointer<AccessPoint> Ptr;
     typedef QList<Ptr> List;
@@ -92,6 +100,11 @@ public:
      * @return The Service Set Identifier identifying the access point.
      */
     QString ssid() const;
+    /**
+     * Bindable counterpart of ssid()
+     * @since 5.94.0
+     */
+    QBindable<QString> bindableSsid();
     /**
      * @return raw SSID, encoded as a byte array
      */
@@ -100,6 +113,11 @@ public:
      * @return The radio channel frequency in use by the access point, in MHz.
      */
     uint frequency() const;
+    /**
+     * Bindable counterpart of frequency()
+     * @since 5.94.0
+     */
+    QBindable<uint> bindableFrequency();
     /**
      * @return The hardware address (BSSID) of the access point.
      */
@@ -108,6 +126,11 @@ public:
      * @return The maximum bitrate this access point is capable of, in kilobits/second (Kb/s).
      */
     uint maxBitRate() const;
+    /**
+     * Bindable counterpart of maxBitRate()
+     * @since 5.94.0
+     */
+    QBindable<uint> bindableMaxBitRate();
     /**
      * @return Describes the operating mode of the access point.
      */
@@ -116,12 +139,24 @@ public:
      * @return The current signal quality of the access point, in percent.
      */
     int signalStrength() const;
+    /**
+     * Bindable counterpart of signalStrength(). Bindings depending on it are
+     * re-evaluated as soon as the strength changes, whether or not they are
+     * read.
+     * @since 5.94.0
+     */
+    QBindable<int> bindableSignalStrength();
     /**
      * @return The timestamp (in CLOCK_BOOTTIME seconds) for the last time the access point
      * was found in scan results. A value of -1 means the access point has never been found in scan results.
      * @since 5.14.0
      */
     int lastSeen() const;
+    /**
+     * Bindable counterpart of lastSeen()
+     * @since 5.94.0
+     */
+    QBindable<int> bindableLastSeen();
 
     /**
      * Helper method to convert wire representation of operation @p mode to enum
@@ -25,15 +25,16 @@ public:
     AccessPoint::Capabilities capabilities;
     AccessPoint::WpaFlags wpaFlags;
     AccessPoint::WpaFlags rsnFlags;
-    QString ssid;
     QByteArray rawSsid;
-    uint frequency;
     QString hardwareAddress;
-    uint maxBitRate;
     AccessPoint::OperationMode mode;
-    int signalStrength;
 
-    int lastSeen;
+    // The public class only exposes them, change notification is emitted by hand
+    Q_OBJECT_BINDABLE_PROPERTY(AccessPointPrivate, QString, ssid)
+    Q_OBJECT_BINDABLE_PROPERTY(AccessPointPrivate, uint, frequency)
+    Q_OBJECT_BINDABLE_PROPERTY(AccessPointPrivate, uint, maxBitRate)
+    Q_OBJECT_BINDABLE_PROPERTY(AccessPointPrivate, int, signalStrength)
+    Q_OBJECT_BINDABLE_PROPERTY(AccessPointPrivate, int, lastSeen)
 
     NetworkManager::AccessPoint::Capabilities convertCapabilities(int caps);
     NetworkManager::AccessPoint::WpaFlags convertWpaFlags(uint theirFlags);
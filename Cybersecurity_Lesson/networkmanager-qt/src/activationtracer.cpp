@@ -0,0 +1,325 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "activationtracer.h"
+#include "manager.h"
+#include "manager_p.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+bool isActivationPhase(NetworkManager::Device::State state)
+{
+    return state >= NetworkManager::Device::Preparing && state < NetworkManager::Device::Activated;
+}
+
+// The names NetworkManager itself uses for the activation stages
+QString phaseName(NetworkManager::Device::State state)
+{
+    switch (state) {
+    case NetworkManager::Device::Preparing:
+        return QStringLiteral("prepare");
+    case NetworkManager::Device::ConfiguringHardware:
+        return QStringLiteral("config");
+    case NetworkManager::Device::NeedAuth:
+        return QStringLiteral("need-auth");
+    case NetworkManager::Device::ConfiguringIp:
+        return QStringLiteral("ip-config");
+    case NetworkManager::Device::CheckingIp:
+        return QStringLiteral("ip-check");
+    case NetworkManager::Device::WaitingForSecondaries:
+        return QStringLiteral("secondaries");
+    default:
+        return QString();
+    }
+}
+}
+
+namespace NetworkManager
+{
+class ActivationTracerPrivate
+{
+public:
+    explicit ActivationTracerPrivate(ActivationTracer *q);
+
+    void activeConnectionAdded(const QString &path);
+    void finish(const QString &path);
+
+    QList<ActivationTracer::Trace> traces;
+    int capacity;
+    // activations which didn't finish yet, by the path of the active connection
+    QHash<QString, ActiveConnection::Ptr> pending;
+
+    Q_DECLARE_PUBLIC(ActivationTracer)
+    ActivationTracer *q_ptr;
+};
+}
+
+NetworkManager::ActivationTracerPrivate::ActivationTracerPrivate(ActivationTracer *q)
+    : capacity(256)
+    , q_ptr(q)
+{
+}
+
+void NetworkManager::ActivationTracerPrivate::activeConnectionAdded(const QString &path)
+{
+    Q_Q(ActivationTracer);
+
+    const ActiveConnection::Ptr activeConnection = findActiveConnection(path);
+    if (!activeConnection || pending.contains(path)) {
+        return;
+    }
+
+    pending.insert(path, activeConnection);
+    QObject::connect(activeConnection.data(), &ActiveConnection::stateChanged, q, [this, path](ActiveConnection::State state) {
+        if (state == ActiveConnection::Activated || state == ActiveConnection::Deactivated) {
+            finish(path);
+        }
+    });
+    if (activeConnection->state() == ActiveConnection::Activated) {
+        finish(path);
+    }
+}
+
+void NetworkManager::ActivationTracerPrivate::finish(const QString &path)
+{
+    Q_Q(ActivationTracer);
+
+    const ActiveConnection::Ptr activeConnection = pending.take(path);
+    if (!activeConnection) {
+        return;
+    }
+    QObject::disconnect(activeConnection.data(), nullptr, q, nullptr);
+
+    const QStringList devices = activeConnection->devices();
+    const Device::Ptr device = devices.isEmpty() ? Device::Ptr() : findNetworkInterface(devices.constFirst());
+    traces.append(ActivationTracer::trace(activeConnection, device));
+    if (traces.size() > capacity) {
+        traces.remove(0, traces.size() - capacity);
+    }
+    Q_EMIT q->traceAdded(path);
+}
+
+qint64 NetworkManager::ActivationTracer::Trace::phaseDuration(Device::State state) const
+{
+    qint64 duration = -1;
+    for (const Phase &phase : phases) {
+        if (phase.state == state) {
+            duration = qMax<qint64>(duration, 0) + phase.duration;
+        }
+    }
+    return duration;
+}
+
+NetworkManager::ActivationTracer::ActivationTracer(QObject *parent)
+    : QObject(parent)
+    , d_ptr(new ActivationTracerPrivate(this))
+{
+    Q_D(ActivationTracer);
+
+    connect(notifier(), &Notifier::activeConnectionAdded, this, [d](const QString &path) {
+        d->activeConnectionAdded(path);
+    });
+    // an activation which failed early may disappear without reaching Deactivated
+    connect(notifier(), &Notifier::activeConnectionRemoved, this, [d](const QString &path) {
+        d->finish(path);
+    });
+    const ActiveConnection::List active = activeConnections();
+    for (const ActiveConnection::Ptr &activeConnection : active) {
+        if (activeConnection->state() == ActiveConnection::Activating) {
+            d->activeConnectionAdded(activeConnection->path());
+        }
+    }
+}
+
+NetworkManager::ActivationTracer::~ActivationTracer()
+{
+    delete d_ptr;
+}
+
+int NetworkManager::ActivationTracer::capacity() const
+{
+    Q_D(const ActivationTracer);
+
+    return d->capacity;
+}
+
+void NetworkManager::ActivationTracer::setCapacity(int capacity)
+{
+    Q_D(ActivationTracer);
+
+    d->capacity = qMax(0, capacity);
+    if (d->traces.size() > d->capacity) {
+        d->traces.remove(0, d->traces.size() - d->capacity);
+    }
+}
+
+QList<NetworkManager::ActivationTracer::Trace> NetworkManager::ActivationTracer::traces() const
+{
+    Q_D(const ActivationTracer);
+
+    return d->traces;
+}
+
+void NetworkManager::ActivationTracer::clear()
+{
+    Q_D(ActivationTracer);
+
+    d->traces.clear();
+}
+
+qint64 NetworkManager::ActivationTracer::percentile(double percent, Device::State phase) const
+{
+    Q_D(const ActivationTracer);
+
+    QList<qint64> durations;
+    durations.reserve(d->traces.size());
+    for (const Trace &trace : std::as_const(d->traces)) {
+        if (trace.result != ActiveConnection::Activated) {
+            continue;
+        }
+        const qint64 duration = phase == Device::UnknownState ? trace.duration() : trace.phaseDuration(phase);
+        if (duration >= 0) {
+            durations << duration;
+        }
+    }
+    if (durations.isEmpty()) {
+        return -1;
+    }
+
+    // nearest rank
+    std::sort(durations.begin(), durations.end());
+    const qsizetype rank = qsizetype(std::ceil(qBound(0.0, percent, 100.0) / 100.0 * durations.size()));
+    return durations.at(qBound<qsizetype>(1, rank, durations.size()) - 1);
+}
+
+QByteArray NetworkManager::ActivationTracer::toChromeTrace() const
+{
+    Q_D(const ActivationTracer);
+
+    // one thread row per interface, VPN connections share row 0
+    QStringList interfaces;
+    QJsonArray events;
+    for (const Trace &trace : std::as_const(d->traces)) {
+        int tid = 0;
+        if (!trace.interfaceName.isEmpty()) {
+            tid = interfaces.indexOf(trace.interfaceName) + 1;
+            if (!tid) {
+                interfaces << trace.interfaceName;
+                tid = interfaces.size();
+            }
+        }
+
+        events.append(QJsonObject{
+            {QStringLiteral("name"), trace.id},
+            {QStringLiteral("cat"), QStringLiteral("activation")},
+            {QStringLiteral("ph"), QStringLiteral("X")},
+            {QStringLiteral("ts"), trace.start},
+            {QStringLiteral("dur"), trace.duration()},
+            {QStringLiteral("pid"), 1},
+            {QStringLiteral("tid"), tid},
+            {QStringLiteral("args"),
+             QJsonObject{
+                 {QStringLiteral("uuid"), trace.uuid},
+                 {QStringLiteral("device"), trace.interfaceName},
+                 {QStringLiteral("activated"), trace.result == ActiveConnection::Activated},
+             }},
+        });
+        for (const Phase &phase : trace.phases) {
+            events.append(QJsonObject{
+                {QStringLiteral("name"), phaseName(phase.state)},
+                {QStringLiteral("cat"), QStringLiteral("device")},
+                {QStringLiteral("ph"), QStringLiteral("X")},
+                {QStringLiteral("ts"), phase.start},
+                {QStringLiteral("dur"), phase.duration},
+                {QStringLiteral("pid"), 1},
+                {QStringLiteral("tid"), tid},
+            });
+        }
+    }
+
+    for (int i = 0; i < interfaces.size(); ++i) {
+        events.append(QJsonObject{
+            {QStringLiteral("name"), QStringLiteral("thread_name")},
+            {QStringLiteral("ph"), QStringLiteral("M")},
+            {QStringLiteral("pid"), 1},
+            {QStringLiteral("tid"), i + 1},
+            {QStringLiteral("args"), QJsonObject{{QStringLiteral("name"), interfaces.at(i)}}},
+        });
+    }
+
+    const QJsonObject root{
+        {QStringLiteral("traceEvents"), events},
+        {QStringLiteral("displayTimeUnit"), QStringLiteral("ms")},
+    };
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+NetworkManager::ActivationTracer::Trace NetworkManager::ActivationTracer::trace(const ActiveConnection::Ptr &activeConnection, const Device::Ptr &device)
+{
+    Trace trace;
+    if (!activeConnection) {
+        return trace;
+    }
+
+    trace.activeConnection = activeConnection->path();
+    trace.id = activeConnection->id();
+    trace.uuid = activeConnection->uuid();
+    trace.connectionTransitions = activeConnection->stateTransitions();
+    if (trace.connectionTransitions.isEmpty()) {
+        trace.start = trace.end = NetworkManagerPrivate::monotonicTimestamp();
+    } else {
+        trace.start = trace.connectionTransitions.constFirst().timestamp;
+        trace.end = trace.connectionTransitions.constLast().timestamp;
+    }
+    trace.result = activeConnection->state();
+    for (const ActiveConnection::StateTransition &transition : std::as_const(trace.connectionTransitions)) {
+        if (transition.state == ActiveConnection::Activated || transition.state == ActiveConnection::Deactivated) {
+            trace.end = transition.timestamp;
+            trace.result = transition.state;
+            break;
+        }
+    }
+
+    if (!device) {
+        return trace;
+    }
+
+    trace.device = device->uni();
+    trace.interfaceName = device->interfaceName();
+
+    // the activation on the device starts with the last Preparing before the end
+    const QList<Device::StateTransition> transitions = device->stateTransitions();
+    qsizetype first = -1;
+    for (qsizetype i = 0; i < transitions.size() && transitions.at(i).timestamp <= trace.end; ++i) {
+        if (transitions.at(i).newState == Device::Preparing) {
+            first = i;
+        }
+    }
+    if (first < 0) {
+        return trace;
+    }
+
+    for (qsizetype i = first; i < transitions.size() && transitions.at(i).timestamp <= trace.end; ++i) {
+        trace.deviceTransitions << transitions.at(i);
+    }
+    trace.start = qMin(trace.start, trace.deviceTransitions.constFirst().timestamp);
+    for (qsizetype i = 0; i < trace.deviceTransitions.size(); ++i) {
+        const Device::StateTransition &transition = trace.deviceTransitions.at(i);
+        if (!isActivationPhase(transition.newState)) {
+            continue;
+        }
+        const qint64 next = i + 1 < trace.deviceTransitions.size() ? trace.deviceTransitions.at(i + 1).timestamp : trace.end;
+        trace.phases << Phase{transition.newState, transition.timestamp, qMax<qint64>(0, next - transition.timestamp)};
+    }
+    return trace;
+}
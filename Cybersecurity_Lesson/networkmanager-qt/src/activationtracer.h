@@ -0,0 +1,132 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_ACTIVATION_TRACER_H
+#define NETWORKMANAGERQT_ACTIVATION_TRACER_H
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include "activeconnection.h"
+#include "device.h"
+
+#include <QObject>
+
+namespace NetworkManager
+{
+class ActivationTracerPrivate;
+
+/**
+ * Collects where the time of connection activations goes.
+ *
+ * For every connection activated while the tracer exists, the state
+ * transitions recorded by the ActiveConnection and its Device are combined
+ * into a Trace once the connection is activated or fails. The device states
+ * between Preparing and Activated make up the phases of the activation.
+ *
+ * @since 5.94.0
+ */
+class NETWORKMANAGERQT_EXPORT ActivationTracer : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int capacity READ capacity WRITE setCapacity)
+
+public:
+    /**
+     * Time spent in one device state
+     */
+    struct Phase {
+        Device::State state;
+        /**
+         * Microseconds of the monotonic clock
+         */
+        qint64 start;
+        /**
+         * Microseconds until the next state or the end of the activation
+         */
+        qint64 duration;
+    };
+
+    struct Trace {
+        QString activeConnection;
+        QString id;
+        QString uuid;
+        /**
+         * Device the connection was activated on, empty for VPN connections
+         */
+        QString device;
+        QString interfaceName;
+        /**
+         * Microseconds of the monotonic clock
+         */
+        qint64 start = -1;
+        qint64 end = -1;
+        /**
+         * Activated on success, Deactivated if the activation failed
+         */
+        ActiveConnection::State result = ActiveConnection::Unknown;
+        QList<ActiveConnection::StateTransition> connectionTransitions;
+        QList<Device::StateTransition> deviceTransitions;
+        QList<Phase> phases;
+
+        qint64 duration() const
+        {
+            return end - start;
+        }
+        /**
+         * Returns the time spent in @p state, -1 if the activation didn't go through it
+         */
+        qint64 phaseDuration(Device::State state) const;
+    };
+
+    explicit ActivationTracer(QObject *parent = nullptr);
+    ~ActivationTracer() override;
+
+    /**
+     * Maximum number of traces kept, the oldest are dropped first. 256 by default.
+     */
+    int capacity() const;
+    void setCapacity(int capacity);
+
+    /**
+     * Returns the finished activations, oldest first
+     */
+    QList<Trace> traces() const;
+    void clear();
+
+    /**
+     * Returns the @p percent percentile of the time spent in @p phase over all
+     * traces which went through it, or of the total activation time for
+     * Device::UnknownState. Only successful activations are taken into account.
+     * @return microseconds, -1 if there is no such trace
+     */
+    qint64 percentile(double percent, Device::State phase = Device::UnknownState) const;
+
+    /**
+     * Returns the traces in the Chrome trace event format, as loaded by
+     * chrome://tracing or Perfetto
+     */
+    QByteArray toChromeTrace() const;
+
+    /**
+     * Builds the trace of an activation from the state transitions of the
+     * active connection and those of its device
+     */
+    static Trace trace(const ActiveConnection::Ptr &activeConnection, const Device::Ptr &device);
+
+Q_SIGNALS:
+    /**
+     * Emitted when the trace of @p activeConnection was added
+     */
+    void traceAdded(const QString &activeConnection);
+
+private:
+    Q_DECLARE_PRIVATE(ActivationTracer)
+    ActivationTracerPrivate *const d_ptr;
+};
+
+}
+
+#endif // NETWORKMANAGERQT_ACTIVATION_TRACER_H
@@ -222,6 +222,13 @@ NetworkManager::ActiveConnection::State NetworkManager::ActiveConnection::state(
     return d->state;
 }
 
+QList<NetworkManager::ActiveConnection::StateTransition> NetworkManager::ActiveConnection::stateTransitions() const
+{
+    Q_D(const ActiveConnection);
+
+    return d->stateTransitions;
+}
+
 bool NetworkManager::ActiveConnection::vpn() const
 {
     Q_D(const ActiveConnection);
@@ -288,6 +295,7 @@ void NetworkManager::ActiveConnectionPrivate::recheckProperties()
             watcher->deleteLater();
             if (property == QLatin1String("State")) {
                 state = NetworkManager::ActiveConnectionPrivate::convertActiveConnectionState(iface.state());
+                recordStateTransition(state);
                 Q_EMIT q->stateChanged(state);
             }
             if (property == QLatin1String("Ip4Config")) {
@@ -329,10 +337,23 @@ void NetworkManager::ActiveConnectionPrivate::propertiesChanged(const QVariantMa
     }
 }
 
+void NetworkManager::ActiveConnectionPrivate::recordStateTransition(ActiveConnection::State newState, ActiveConnection::Reason reason)
+{
+    // the State property and the StateChanged signal both report a transition, merge them
+    if (!stateTransitions.isEmpty() && stateTransitions.constLast().state == newState) {
+        if (reason != ActiveConnection::UknownReason) {
+            stateTransitions.last().reason = reason;
+        }
+        return;
+    }
+    stateTransitions.append({NetworkManagerPrivate::monotonicTimestamp(), newState, reason});
+}
+
 void NetworkManager::ActiveConnectionPrivate::stateChanged(uint state, uint reason)
 {
     Q_Q(ActiveConnection);
 
+    recordStateTransition(convertActiveConnectionState(state), convertActiveConnectionReason(reason));
     Q_EMIT q->stateChangedReason(convertActiveConnectionState(state), convertActiveConnectionReason(reason));
 }
 
@@ -413,6 +434,7 @@ void NetworkManager::ActiveConnectionPrivate::propertyChanged(const QString &pro
         Q_EMIT q->specificObjectChanged(specificObject);
     } else if (property == QLatin1String("State")) {
         state = NetworkManager::ActiveConnectionPrivate::convertActiveConnectionState(value.toUInt());
+        recordStateTransition(state);
         Q_EMIT q->stateChanged(state);
     } else if (property == QLatin1String("Vpn")) {
         vpn = value.toBool();
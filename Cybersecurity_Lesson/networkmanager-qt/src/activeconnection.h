@@ -62,6 +62,19 @@ public:
         DeviceRemoved, /**< The device this connection depended on disappeared */
     };
 
+    /**
+     * A state the connection entered
+     * @since 5.94.0
+     */
+    struct StateTransition {
+        /**
+         * Microseconds of the monotonic clock, comparable with Device::StateTransition::timestamp
+         */
+        qint64 timestamp;
+        State state;
+        Reason reason;
+    };
+
     /**
      * Creates a new ActiveConnection object.
      *
@@ -140,6 +153,12 @@ public:
      * The current state of the connection
      */
     NetworkManager::ActiveConnection::State state() const;
+    /**
+     * Returns the states this connection went through since this object was
+     * created, oldest first. The first entry is the state it was created in.
+     * @since 5.94.0
+     */
+    QList<StateTransition> stateTransitions() const;
     /**
      * Whether this is a VPN connection
      */
@@ -38,6 +38,7 @@ public:
     QString type;
     QString specificObject;
     ActiveConnection::State state;
+    QList<ActiveConnection::StateTransition> stateTransitions;
     bool vpn;
     QString uuid;
     QString master;
@@ -51,6 +52,8 @@ public:
      */
     void recheckProperties();
 
+    void recordStateTransition(ActiveConnection::State newState, ActiveConnection::Reason reason = ActiveConnection::UknownReason);
+
 public:
     /**
      * When subclassing make sure to call the parent class method
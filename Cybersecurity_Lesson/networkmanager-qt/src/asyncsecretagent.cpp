@@ -0,0 +1,480 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "asyncsecretagent.h"
+#include "nmdebug.h"
+
+#include <QDBusConnection>
+#include <QDataStream>
+#include <QDeadlineTimer>
+#include <QIODevice>
+#include <QQueue>
+#include <QSharedPointer>
+#include <QTimer>
+
+#include <cstring>
+
+#include <sys/mman.h>
+
+namespace
+{
+using Key = QPair<QString, QString>;
+
+void wipe(void *data, size_t size)
+{
+    // volatile keeps the compiler from dropping stores to memory about to be freed
+    volatile char *p = static_cast<volatile char *>(data);
+    while (size--) {
+        *p++ = 0;
+    }
+}
+
+// Unbuffered device writing to a fixed block of memory, without one it only counts the bytes written
+class MemoryWriter : public QIODevice
+{
+public:
+    explicit MemoryWriter(char *data = nullptr, size_t capacity = 0)
+        : m_data(data)
+        , m_capacity(capacity)
+    {
+        open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+    }
+
+    bool isSequential() const override
+    {
+        return true;
+    }
+
+    size_t written() const
+    {
+        return m_written;
+    }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override
+    {
+        Q_UNUSED(data)
+        Q_UNUSED(maxSize)
+        return -1;
+    }
+
+    qint64 writeData(const char *data, qint64 size) override
+    {
+        if (m_data) {
+            if (m_written + size_t(size) > m_capacity) {
+                return -1;
+            }
+            memcpy(m_data + m_written, data, size);
+        }
+        m_written += size;
+        return size;
+    }
+
+private:
+    char *m_data;
+    size_t m_capacity;
+    size_t m_written = 0;
+};
+
+// Serialized secrets in memory which is kept out of swap and core dumps, and wiped when released
+class LockedSecrets
+{
+public:
+    explicit LockedSecrets(const NMVariantMapMap &secrets);
+    ~LockedSecrets();
+    Q_DISABLE_COPY(LockedSecrets)
+
+    NMVariantMapMap secrets() const;
+
+private:
+    void release();
+
+    char *m_data = nullptr;
+    size_t m_size = 0;
+    bool m_locked = false;
+};
+
+LockedSecrets::LockedSecrets(const NMVariantMapMap &secrets)
+{
+    // measure the secrets first, so they are serialized straight into the locked
+    // memory and no copy of them is left behind in a growing buffer
+    MemoryWriter counter;
+    {
+        QDataStream stream(&counter);
+        stream << secrets;
+    }
+    const size_t size = counter.written();
+
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        return;
+    }
+    m_data = static_cast<char *>(data);
+    m_size = size;
+    m_locked = mlock(m_data, m_size) == 0;
+    if (!m_locked) {
+        qCDebug(NMQT) << "Failed to lock the memory of cached secrets";
+    }
+#ifdef MADV_DONTDUMP
+    madvise(m_data, m_size, MADV_DONTDUMP);
+#endif
+
+    MemoryWriter writer(m_data, m_size);
+    QDataStream stream(&writer);
+    stream << secrets;
+    if (stream.status() != QDataStream::Ok || writer.written() != m_size) {
+        qCWarning(NMQT) << "Failed to serialize cached secrets";
+        release();
+    }
+}
+
+LockedSecrets::~LockedSecrets()
+{
+    release();
+}
+
+void LockedSecrets::release()
+{
+    if (!m_data) {
+        return;
+    }
+    wipe(m_data, m_size);
+    if (m_locked) {
+        munlock(m_data, m_size);
+    }
+    munmap(m_data, m_size);
+    m_data = nullptr;
+    m_size = 0;
+    m_locked = false;
+}
+
+NMVariantMapMap LockedSecrets::secrets() const
+{
+    NMVariantMapMap secrets;
+    if (m_data) {
+        QDataStream stream(QByteArray::fromRawData(m_data, m_size));
+        stream >> secrets;
+    }
+    return secrets;
+}
+
+struct CacheEntry {
+    QSharedPointer<LockedSecrets> secrets;
+    QDeadlineTimer deadline;
+};
+}
+
+namespace NetworkManager
+{
+class AsyncSecretAgentPrivate
+{
+public:
+    explicit AsyncSecretAgentPrivate(AsyncSecretAgent *q);
+
+    struct Pending {
+        AsyncSecretAgent::Request request;
+        // the GetSecrets calls waiting for this request
+        QList<QDBusMessage> waiters;
+        bool running = false;
+    };
+
+    void dispatch();
+    // removes the request @p id, returns whether there was one
+    bool take(quint64 id, Pending *pending);
+    void expireCache();
+    void scheduleExpiry();
+
+    QHash<quint64, Pending> requests;
+    QQueue<quint64> queue;
+    // the id of the queued or running request for a connection and setting
+    QHash<Key, quint64> inFlight;
+    QHash<Key, CacheEntry> cache;
+    QTimer expiryTimer;
+    QDBusConnection connection;
+    quint64 lastId;
+    int running;
+    int maxConcurrentRequests;
+    int cacheLifetime;
+    bool dispatching;
+
+    Q_DECLARE_PUBLIC(AsyncSecretAgent)
+    AsyncSecretAgent *q_ptr;
+};
+}
+
+NetworkManager::AsyncSecretAgentPrivate::AsyncSecretAgentPrivate(AsyncSecretAgent *q)
+    : connection(QString())
+    , lastId(0)
+    , running(0)
+    , maxConcurrentRequests(1)
+    , cacheLifetime(10000)
+    , dispatching(false)
+    , q_ptr(q)
+{
+    expiryTimer.setSingleShot(true);
+    QObject::connect(&expiryTimer, &QTimer::timeout, q, [this]() {
+        expireCache();
+    });
+}
+
+void NetworkManager::AsyncSecretAgentPrivate::dispatch()
+{
+    Q_Q(AsyncSecretAgent);
+
+    // requestSecrets() may finish synchronously, which dispatches again
+    if (dispatching) {
+        return;
+    }
+    dispatching = true;
+    while (running < maxConcurrentRequests && !queue.isEmpty()) {
+        const quint64 id = queue.dequeue();
+        Pending &pending = requests[id];
+        pending.running = true;
+        ++running;
+        const AsyncSecretAgent::Request request = pending.request;
+        q->requestSecrets(request);
+    }
+    dispatching = false;
+}
+
+bool NetworkManager::AsyncSecretAgentPrivate::take(quint64 id, Pending *pending)
+{
+    const auto it = requests.find(id);
+    if (it == requests.end()) {
+        return false;
+    }
+
+    *pending = it.value();
+    requests.erase(it);
+    inFlight.remove(Key(pending->request.connectionPath.path(), pending->request.settingName));
+    if (pending->running) {
+        --running;
+    } else {
+        queue.removeOne(id);
+    }
+    return true;
+}
+
+void NetworkManager::AsyncSecretAgentPrivate::expireCache()
+{
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->deadline.hasExpired()) {
+            it = cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    scheduleExpiry();
+}
+
+void NetworkManager::AsyncSecretAgentPrivate::scheduleExpiry()
+{
+    if (cache.isEmpty()) {
+        expiryTimer.stop();
+        return;
+    }
+
+    QDeadlineTimer next = QDeadlineTimer::Forever;
+    for (const CacheEntry &entry : std::as_const(cache)) {
+        next = qMin(next, entry.deadline);
+    }
+    expiryTimer.start(qMax<qint64>(0, next.remainingTime()));
+}
+
+NetworkManager::AsyncSecretAgent::AsyncSecretAgent(const QString &id, QObject *parent)
+    : SecretAgent(id, parent)
+    , d_ptr(new AsyncSecretAgentPrivate(this))
+{
+}
+
+NetworkManager::AsyncSecretAgent::AsyncSecretAgent(const QString &id, NetworkManager::SecretAgent::Capabilities capabilities, QObject *parent)
+    : SecretAgent(id, capabilities, parent)
+    , d_ptr(new AsyncSecretAgentPrivate(this))
+{
+}
+
+NetworkManager::AsyncSecretAgent::~AsyncSecretAgent()
+{
+    delete d_ptr;
+}
+
+int NetworkManager::AsyncSecretAgent::maxConcurrentRequests() const
+{
+    Q_D(const AsyncSecretAgent);
+
+    return d->maxConcurrentRequests;
+}
+
+void NetworkManager::AsyncSecretAgent::setMaxConcurrentRequests(int count)
+{
+    Q_D(AsyncSecretAgent);
+
+    d->maxConcurrentRequests = qMax(1, count);
+    d->dispatch();
+}
+
+int NetworkManager::AsyncSecretAgent::cacheLifetime() const
+{
+    Q_D(const AsyncSecretAgent);
+
+    return d->cacheLifetime;
+}
+
+void NetworkManager::AsyncSecretAgent::setCacheLifetime(int msecs)
+{
+    Q_D(AsyncSecretAgent);
+
+    d->cacheLifetime = qMax(0, msecs);
+    if (!d->cacheLifetime) {
+        clearCache();
+    }
+}
+
+void NetworkManager::AsyncSecretAgent::invalidateCache(const QDBusObjectPath &connectionPath)
+{
+    Q_D(AsyncSecretAgent);
+
+    for (auto it = d->cache.begin(); it != d->cache.end();) {
+        if (it.key().first == connectionPath.path()) {
+            it = d->cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    d->scheduleExpiry();
+}
+
+void NetworkManager::AsyncSecretAgent::clearCache()
+{
+    Q_D(AsyncSecretAgent);
+
+    d->cache.clear();
+    d->expiryTimer.stop();
+}
+
+int NetworkManager::AsyncSecretAgent::queuedCount() const
+{
+    Q_D(const AsyncSecretAgent);
+
+    return d->queue.size();
+}
+
+int NetworkManager::AsyncSecretAgent::runningCount() const
+{
+    Q_D(const AsyncSecretAgent);
+
+    return d->running;
+}
+
+NMVariantMapMap NetworkManager::AsyncSecretAgent::GetSecrets(const NMVariantMapMap &connection,
+                                                             const QDBusObjectPath &connection_path,
+                                                             const QString &setting_name,
+                                                             const QStringList &hints,
+                                                             uint flags)
+{
+    Q_D(AsyncSecretAgent);
+
+    const Key key(connection_path.path(), setting_name);
+    const GetSecretsFlags requestFlags(flags);
+    if (requestFlags.testFlag(RequestNew)) {
+        // NetworkManager considers what we have wrong
+        d->cache.remove(key);
+    } else {
+        const auto it = d->cache.constFind(key);
+        if (it != d->cache.constEnd() && !it->deadline.hasExpired()) {
+            return it->secrets->secrets();
+        }
+    }
+
+    setDelayedReply(true);
+    d->connection = QDBusContext::connection();
+
+    const quint64 id = d->inFlight.value(key);
+    if (id) {
+        d->requests[id].waiters << message();
+        return NMVariantMapMap();
+    }
+
+    AsyncSecretAgentPrivate::Pending pending;
+    pending.request.id = ++d->lastId;
+    pending.request.connection = connection;
+    pending.request.connectionPath = connection_path;
+    pending.request.settingName = setting_name;
+    pending.request.hints = hints;
+    pending.request.flags = requestFlags;
+    pending.waiters << message();
+    d->requests.insert(pending.request.id, pending);
+    d->inFlight.insert(key, pending.request.id);
+    d->queue.enqueue(pending.request.id);
+    d->dispatch();
+    return NMVariantMapMap();
+}
+
+void NetworkManager::AsyncSecretAgent::CancelGetSecrets(const QDBusObjectPath &connection_path, const QString &setting_name)
+{
+    Q_D(AsyncSecretAgent);
+
+    const quint64 id = d->inFlight.value(Key(connection_path.path(), setting_name));
+    AsyncSecretAgentPrivate::Pending pending;
+    if (!id || !d->take(id, &pending)) {
+        return;
+    }
+
+    for (const QDBusMessage &waiter : std::as_const(pending.waiters)) {
+        sendError(AgentCanceled, QStringLiteral("The request was canceled by NetworkManager"), waiter);
+    }
+    if (pending.running) {
+        requestCanceled(id);
+    }
+    d->dispatch();
+}
+
+void NetworkManager::AsyncSecretAgent::requestCanceled(quint64 id)
+{
+    Q_UNUSED(id)
+}
+
+void NetworkManager::AsyncSecretAgent::finishRequest(quint64 id, const NMVariantMapMap &secrets, bool cache)
+{
+    Q_D(AsyncSecretAgent);
+
+    AsyncSecretAgentPrivate::Pending pending;
+    if (!d->take(id, &pending)) {
+        return;
+    }
+
+    for (const QDBusMessage &waiter : std::as_const(pending.waiters)) {
+        QDBusMessage reply = waiter.createReply();
+        reply << QVariant::fromValue(secrets);
+        if (!d->connection.send(reply)) {
+            qCWarning(NMQT) << "Failed to send secrets for" << pending.request.connectionPath.path() << pending.request.settingName;
+        }
+    }
+
+    if (cache && d->cacheLifetime > 0) {
+        const Key key(pending.request.connectionPath.path(), pending.request.settingName);
+        d->cache.insert(key, CacheEntry{QSharedPointer<LockedSecrets>::create(secrets), QDeadlineTimer(d->cacheLifetime)});
+        d->scheduleExpiry();
+    }
+    d->dispatch();
+}
+
+void NetworkManager::AsyncSecretAgent::failRequest(quint64 id, Error error, const QString &explanation)
+{
+    Q_D(AsyncSecretAgent);
+
+    AsyncSecretAgentPrivate::Pending pending;
+    if (!d->take(id, &pending)) {
+        return;
+    }
+
+    for (const QDBusMessage &waiter : std::as_const(pending.waiters)) {
+        sendError(error, explanation, waiter);
+    }
+    d->dispatch();
+}
+
+#include "moc_asyncsecretagent.cpp"
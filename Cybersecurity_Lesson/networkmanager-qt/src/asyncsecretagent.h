@@ -0,0 +1,125 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_ASYNC_SECRETAGENT_H
+#define NETWORKMANAGERQT_ASYNC_SECRETAGENT_H
+
+#include "secretagent.h"
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+namespace NetworkManager
+{
+class AsyncSecretAgentPrivate;
+
+/**
+ * A SecretAgent which answers GetSecrets requests asynchronously.
+ *
+ * Every GetSecrets call is replied to later, so the D-Bus call returns
+ * immediately. Requests are queued and at most maxConcurrentRequests() of
+ * them are handed to requestSecrets() at a time. A request for a connection
+ * and setting which is already queued or running doesn't start a new one,
+ * it gets the same answer. Secrets delivered with finishRequest() are kept
+ * in locked memory for cacheLifetime() milliseconds and answer repeated
+ * requests without asking the subclass again, unless NetworkManager asks
+ * for new secrets.
+ *
+ * Subclasses implement requestSecrets() and eventually call finishRequest()
+ * or failRequest() with the id of the request, as well as SaveSecrets() and
+ * DeleteSecrets(). They should call invalidateCache() when the stored
+ * secrets of a connection change.
+ *
+ * @since 5.94.0
+ */
+class NETWORKMANAGERQT_EXPORT AsyncSecretAgent : public SecretAgent
+{
+    Q_OBJECT
+public:
+    /**
+     * A queued GetSecrets call
+     */
+    struct Request {
+        quint64 id = 0;
+        NMVariantMapMap connection;
+        QDBusObjectPath connectionPath;
+        QString settingName;
+        QStringList hints;
+        GetSecretsFlags flags;
+    };
+
+    explicit AsyncSecretAgent(const QString &id, QObject *parent = nullptr);
+    explicit AsyncSecretAgent(const QString &id, NetworkManager::SecretAgent::Capabilities capabilities, QObject *parent = nullptr);
+    ~AsyncSecretAgent() override;
+
+    /**
+     * Maximum number of requests passed to requestSecrets() which didn't
+     * finish yet, 1 by default so that only one prompt is shown at a time.
+     */
+    int maxConcurrentRequests() const;
+    void setMaxConcurrentRequests(int count);
+
+    /**
+     * Milliseconds for which delivered secrets are cached, 10 seconds by
+     * default. 0 disables the cache.
+     */
+    int cacheLifetime() const;
+    void setCacheLifetime(int msecs);
+
+    /**
+     * Drops the cached secrets of @p connectionPath
+     */
+    void invalidateCache(const QDBusObjectPath &connectionPath);
+    void clearCache();
+
+    /**
+     * Returns the number of requests waiting for a free slot
+     */
+    int queuedCount() const;
+    /**
+     * Returns the number of requests passed to requestSecrets() which didn't finish yet
+     */
+    int runningCount() const;
+
+    NMVariantMapMap GetSecrets(const NMVariantMapMap &connection,
+                               const QDBusObjectPath &connection_path,
+                               const QString &setting_name,
+                               const QStringList &hints,
+                               uint flags) override;
+    void CancelGetSecrets(const QDBusObjectPath &connection_path, const QString &setting_name) override;
+
+protected:
+    /**
+     * Called when the subclass should retrieve the secrets of @p request,
+     * it has to call finishRequest() or failRequest() with the id of the
+     * request once done, which may happen before returning.
+     */
+    virtual void requestSecrets(const NetworkManager::AsyncSecretAgent::Request &request) = 0;
+
+    /**
+     * Called when NetworkManager canceled the running request @p id, for
+     * instance to close its prompt. The request is already answered and
+     * finishing it has no effect anymore. Does nothing by default.
+     */
+    virtual void requestCanceled(quint64 id);
+
+    /**
+     * Answers the request @p id and every identical request with @p secrets,
+     * which are cached unless @p cache is false
+     */
+    void finishRequest(quint64 id, const NMVariantMapMap &secrets, bool cache = true);
+
+    /**
+     * Answers the request @p id and every identical request with @p error
+     */
+    void failRequest(quint64 id, Error error, const QString &explanation);
+
+private:
+    Q_DECLARE_PRIVATE(AsyncSecretAgent)
+    AsyncSecretAgentPrivate *const d_ptr;
+};
+}
+
+#endif // NETWORKMANAGERQT_ASYNC_SECRETAGENT_H
@@ -0,0 +1,300 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "batchactivation.h"
+#include "manager.h"
+
+#include <QDBusPendingCallWatcher>
+#include <QElapsedTimer>
+#include <QSet>
+#include <QTimer>
+
+#include "nmdebug.h"
+
+namespace NetworkManager
+{
+class BatchActivationPrivate
+{
+public:
+    explicit BatchActivationPrivate(BatchActivation *q);
+
+    void replied(int index, const QDBusPendingCall &call);
+    void follow(int index);
+    void activeConnectionAdded(const QString &path);
+    void activeConnectionRemoved(const QString &path);
+    void complete(int index, ActiveConnection::State state, const QString &error = QString());
+    void timedOut();
+
+    QList<BatchActivation::Request> requests;
+    QList<BatchActivation::Result> results;
+    // the requests each active connection belongs to, until they settled
+    QMultiHash<QString, int> pending;
+    // active connections removed before any reply named them
+    QSet<QString> removed;
+    QList<QMetaObject::Connection> stateConnections;
+    QList<bool> done;
+    int completed;
+    int failed;
+    int timeout;
+    bool started;
+    QElapsedTimer timer;
+    QTimer timeoutTimer;
+    qint64 elapsed;
+
+    Q_DECLARE_PUBLIC(BatchActivation)
+    BatchActivation *q_ptr;
+};
+}
+
+NetworkManager::BatchActivationPrivate::BatchActivationPrivate(BatchActivation *q)
+    : completed(0)
+    , failed(0)
+    , timeout(90000)
+    , started(false)
+    , elapsed(-1)
+    , q_ptr(q)
+{
+}
+
+void NetworkManager::BatchActivationPrivate::replied(int index, const QDBusPendingCall &call)
+{
+    if (done.at(index)) {
+        // timed out before NetworkManager replied
+        return;
+    }
+
+    BatchActivation::Result &result = results[index];
+    result.replyLatency = timer.nsecsElapsed() / 1000;
+    if (call.isError()) {
+        qCWarning(NMQT) << "Failed to activate connection" << requests.at(index).connection << call.error().message();
+        complete(index, ActiveConnection::Deactivated, call.error().message());
+        return;
+    }
+
+    // AddAndActivateConnection replies with the new connection first
+    const int argument = requests.at(index).connection.isEmpty() ? 1 : 0;
+    result.activeConnection = call.reply().arguments().value(argument).value<QDBusObjectPath>().path();
+    if (removed.contains(result.activeConnection) && !findActiveConnection(result.activeConnection)) {
+        complete(index, ActiveConnection::Deactivated, QStringLiteral("The active connection was removed"));
+        return;
+    }
+    pending.insert(result.activeConnection, index);
+    follow(index);
+}
+
+void NetworkManager::BatchActivationPrivate::follow(int index)
+{
+    Q_Q(BatchActivation);
+
+    if (stateConnections.at(index)) {
+        return;
+    }
+
+    const QString path = results.at(index).activeConnection;
+    const ActiveConnection::Ptr activeConnection = findActiveConnection(path);
+    if (!activeConnection) {
+        // the manager learns about it with its next ActiveConnections update
+        return;
+    }
+
+    const ActiveConnection::State state = activeConnection->state();
+    if (state == ActiveConnection::Activated || state == ActiveConnection::Deactivated) {
+        complete(index, state);
+        return;
+    }
+    stateConnections[index] = QObject::connect(activeConnection.data(), &ActiveConnection::stateChanged, q, [this, index](ActiveConnection::State state) {
+        if (state == ActiveConnection::Activated || state == ActiveConnection::Deactivated) {
+            complete(index, state);
+        }
+    });
+}
+
+void NetworkManager::BatchActivationPrivate::activeConnectionAdded(const QString &path)
+{
+    const QList<int> indexes = pending.values(path);
+    for (int index : indexes) {
+        follow(index);
+    }
+}
+
+void NetworkManager::BatchActivationPrivate::activeConnectionRemoved(const QString &path)
+{
+    removed.insert(path);
+    const QList<int> indexes = pending.values(path);
+    for (int index : indexes) {
+        complete(index, ActiveConnection::Deactivated, QStringLiteral("The active connection was removed"));
+    }
+}
+
+void NetworkManager::BatchActivationPrivate::complete(int index, ActiveConnection::State state, const QString &error)
+{
+    Q_Q(BatchActivation);
+
+    if (done.at(index)) {
+        return;
+    }
+    done[index] = true;
+
+    BatchActivation::Result &result = results[index];
+    if (!result.activeConnection.isEmpty()) {
+        pending.remove(result.activeConnection, index);
+    }
+    QObject::disconnect(stateConnections.at(index));
+    result.state = state;
+    result.error = error;
+    result.activationTime = timer.nsecsElapsed() / 1000;
+    if (state != ActiveConnection::Activated) {
+        ++failed;
+    }
+    ++completed;
+
+    Q_EMIT q->itemFinished(index);
+    Q_EMIT q->progress(completed, requests.count());
+
+    if (completed == requests.count()) {
+        elapsed = timer.elapsed();
+        timeoutTimer.stop();
+        removed.clear();
+        QObject::disconnect(notifier(), nullptr, q, nullptr);
+        Q_EMIT q->finished();
+    }
+}
+
+void NetworkManager::BatchActivationPrivate::timedOut()
+{
+    for (int i = 0; i < requests.count(); ++i) {
+        if (!done.at(i)) {
+            complete(i, ActiveConnection::Deactivated, QStringLiteral("Timed out waiting for the activation"));
+        }
+    }
+}
+
+NetworkManager::BatchActivation::Request
+NetworkManager::BatchActivation::Request::activate(const QString &connection, const QString &device, const QString &specificObject)
+{
+    Request request;
+    request.connection = connection;
+    request.device = device;
+    request.specificObject = specificObject;
+    return request;
+}
+
+NetworkManager::BatchActivation::Request
+NetworkManager::BatchActivation::Request::addAndActivate(const NMVariantMapMap &settings, const QString &device, const QString &specificObject)
+{
+    Request request;
+    request.settings = settings;
+    request.device = device;
+    request.specificObject = specificObject;
+    return request;
+}
+
+NetworkManager::BatchActivation::BatchActivation(const QList<Request> &requests, QObject *parent)
+    : QObject(parent)
+    , d_ptr(new BatchActivationPrivate(this))
+{
+    Q_D(BatchActivation);
+    d->requests = requests;
+    d->results.resize(requests.count());
+    d->stateConnections.resize(requests.count());
+    d->done.fill(false, requests.count());
+    d->timeoutTimer.setSingleShot(true);
+    connect(&d->timeoutTimer, &QTimer::timeout, this, [d]() {
+        d->timedOut();
+    });
+}
+
+NetworkManager::BatchActivation::~BatchActivation()
+{
+    delete d_ptr;
+}
+
+int NetworkManager::BatchActivation::timeout() const
+{
+    Q_D(const BatchActivation);
+    return d->timeout;
+}
+
+void NetworkManager::BatchActivation::setTimeout(int timeout)
+{
+    Q_D(BatchActivation);
+    d->timeout = qMax(0, timeout);
+}
+
+void NetworkManager::BatchActivation::start()
+{
+    Q_D(BatchActivation);
+    if (d->started) {
+        return;
+    }
+    d->started = true;
+    d->timer.start();
+
+    if (d->requests.isEmpty()) {
+        d->elapsed = 0;
+        QTimer::singleShot(0, this, &BatchActivation::finished);
+        return;
+    }
+
+    connect(notifier(), &Notifier::activeConnectionAdded, this, [d](const QString &path) {
+        d->activeConnectionAdded(path);
+    });
+    connect(notifier(), &Notifier::activeConnectionRemoved, this, [d](const QString &path) {
+        d->activeConnectionRemoved(path);
+    });
+
+    for (int i = 0; i < d->requests.count(); ++i) {
+        const Request &request = d->requests.at(i);
+        const QDBusPendingCall call = request.connection.isEmpty()
+            ? QDBusPendingCall(addAndActivateConnection(request.settings, request.device, request.specificObject))
+            : QDBusPendingCall(activateConnection(request.connection, request.device, request.specificObject));
+        auto watcher = new QDBusPendingCallWatcher(call, this);
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, [d, i](QDBusPendingCallWatcher *watcher) {
+            watcher->deleteLater();
+            d->replied(i, *watcher);
+        });
+    }
+
+    if (d->timeout > 0) {
+        d->timeoutTimer.start(d->timeout);
+    }
+}
+
+int NetworkManager::BatchActivation::count() const
+{
+    Q_D(const BatchActivation);
+    return d->requests.count();
+}
+
+int NetworkManager::BatchActivation::completedCount() const
+{
+    Q_D(const BatchActivation);
+    return d->completed;
+}
+
+int NetworkManager::BatchActivation::failedCount() const
+{
+    Q_D(const BatchActivation);
+    return d->failed;
+}
+
+bool NetworkManager::BatchActivation::isFinished() const
+{
+    Q_D(const BatchActivation);
+    return d->started && d->completed == d->requests.count();
+}
+
+QList<NetworkManager::BatchActivation::Result> NetworkManager::BatchActivation::results() const
+{
+    Q_D(const BatchActivation);
+    return d->results;
+}
+
+qint64 NetworkManager::BatchActivation::elapsed() const
+{
+    Q_D(const BatchActivation);
+    return d->elapsed;
+}
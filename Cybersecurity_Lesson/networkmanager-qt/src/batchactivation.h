@@ -0,0 +1,139 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_BATCH_ACTIVATION_H
+#define NETWORKMANAGERQT_BATCH_ACTIVATION_H
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include "activeconnection.h"
+#include "generictypes.h"
+
+#include <QObject>
+
+namespace NetworkManager
+{
+class BatchActivationPrivate;
+
+/**
+ * Activates several connections at once.
+ *
+ * All activation requests are sent without waiting for each other, then
+ * every resulting ActiveConnection is followed until it is activated or
+ * fails. finished() is emitted once all of them settled, results() then
+ * holds the outcome and timings of each request.
+ *
+ * @since 5.94.0
+ */
+class NETWORKMANAGERQT_EXPORT BatchActivation : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count CONSTANT)
+    Q_PROPERTY(int completedCount READ completedCount NOTIFY progress)
+
+public:
+    /**
+     * A connection to activate
+     */
+    struct Request {
+        /**
+         * Path of the connection to activate, if empty @p settings are added and activated
+         */
+        QString connection;
+        NMVariantMapMap settings;
+        /**
+         * Path of the device to activate the connection on, may be empty for VPN connections
+         */
+        QString device;
+        QString specificObject;
+
+        static Request activate(const QString &connection, const QString &device, const QString &specificObject = QString());
+        static Request addAndActivate(const NMVariantMapMap &settings, const QString &device, const QString &specificObject = QString());
+    };
+
+    /**
+     * Outcome of a single request
+     */
+    struct Result {
+        /**
+         * Path of the active connection, empty if the request was refused
+         */
+        QString activeConnection;
+        /**
+         * Error returned by NetworkManager, or why the activation is considered failed
+         */
+        QString error;
+        /**
+         * Activated on success
+         */
+        ActiveConnection::State state = ActiveConnection::Unknown;
+        /**
+         * Microseconds until NetworkManager replied to the request, -1 while pending
+         */
+        qint64 replyLatency = -1;
+        /**
+         * Microseconds from sending the request until the connection was activated or failed, -1 while pending
+         */
+        qint64 activationTime = -1;
+
+        bool isActivated() const
+        {
+            return state == ActiveConnection::Activated;
+        }
+    };
+
+    explicit BatchActivation(const QList<Request> &requests, QObject *parent = nullptr);
+    ~BatchActivation() override;
+
+    /**
+     * Milliseconds after which activations which didn't settle yet are
+     * considered failed, 0 to wait indefinitely. 90 seconds by default.
+     */
+    int timeout() const;
+    void setTimeout(int timeout);
+
+    /**
+     * Sends all requests, has no effect if already started
+     */
+    void start();
+
+    int count() const;
+    /**
+     * Returns the number of requests which were activated or failed
+     */
+    int completedCount() const;
+    int failedCount() const;
+    bool isFinished() const;
+
+    /**
+     * Returns the results in the order of the requests passed to the constructor
+     */
+    QList<Result> results() const;
+
+    /**
+     * Returns the time in milliseconds from start() until the last activation settled, -1 until finished
+     */
+    qint64 elapsed() const;
+
+Q_SIGNALS:
+    /**
+     * Emitted when the request at @p index was activated or failed
+     */
+    void itemFinished(int index);
+    void progress(int completed, int total);
+    /**
+     * Emitted once every request was activated or failed
+     */
+    void finished();
+
+private:
+    Q_DECLARE_PRIVATE(BatchActivation)
+    BatchActivationPrivate *const d_ptr;
+};
+
+}
+
+#endif // NETWORKMANAGERQT_BATCH_ACTIVATION_H
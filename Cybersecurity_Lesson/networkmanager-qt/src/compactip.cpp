@@ -0,0 +1,335 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "compactip.h"
+
+#include <cstring>
+
+namespace
+{
+int hexValue(char16_t c)
+{
+    if (c >= u'0' && c <= u'9') {
+        return c - u'0';
+    } else if (c >= u'a' && c <= u'f') {
+        return c - u'a' + 10;
+    } else if (c >= u'A' && c <= u'F') {
+        return c - u'A' + 10;
+    }
+    return -1;
+}
+
+// Dotted quad, like inet_pton() octets with leading zeros are rejected
+bool parseIPv4(QStringView text, quint8 *out)
+{
+    int octet = 0;
+    uint value = 0;
+    int digits = 0;
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        const char16_t c = text.at(i).unicode();
+        if (c >= u'0' && c <= u'9') {
+            if (digits == 1 && value == 0) {
+                return false;
+            }
+            value = value * 10 + (c - u'0');
+            if (value > 255) {
+                return false;
+            }
+            ++digits;
+        } else if (c == u'.' && digits && octet < 3) {
+            out[octet++] = quint8(value);
+            value = 0;
+            digits = 0;
+        } else {
+            return false;
+        }
+    }
+    if (!digits || octet != 3) {
+        return false;
+    }
+    out[3] = quint8(value);
+    return true;
+}
+
+// RFC 4291 text form, including "::" and a trailing dotted quad
+bool parseIPv6(QStringView text, quint8 *out)
+{
+    quint8 tmp[16] = {};
+    int tp = 0;
+    int colonp = -1;
+    qsizetype i = 0;
+    const qsizetype size = text.size();
+
+    if (size && text.at(0) == QLatin1Char(':')) {
+        if (size < 2 || text.at(1) != QLatin1Char(':')) {
+            return false;
+        }
+        i = 1;
+    }
+
+    qsizetype token = i;
+    uint value = 0;
+    int digits = 0;
+    bool sawIPv4 = false;
+    for (; i < size; ++i) {
+        const char16_t c = text.at(i).unicode();
+        const int hex = hexValue(c);
+        if (hex >= 0) {
+            if (++digits > 4) {
+                return false;
+            }
+            value = (value << 4) | uint(hex);
+        } else if (c == u':') {
+            token = i + 1;
+            if (!digits) {
+                if (colonp >= 0) {
+                    return false;
+                }
+                colonp = tp;
+                continue;
+            }
+            if (i + 1 >= size || tp + 2 > 16) {
+                return false;
+            }
+            tmp[tp++] = quint8(value >> 8);
+            tmp[tp++] = quint8(value);
+            value = 0;
+            digits = 0;
+        } else if (c == u'.' && tp + 4 <= 16) {
+            if (!parseIPv4(text.mid(token), tmp + tp)) {
+                return false;
+            }
+            tp += 4;
+            digits = 0;
+            sawIPv4 = true;
+            break;
+        } else {
+            return false;
+        }
+    }
+
+    if (digits && !sawIPv4) {
+        if (tp + 2 > 16) {
+            return false;
+        }
+        tmp[tp++] = quint8(value >> 8);
+        tmp[tp++] = quint8(value);
+    }
+    if (colonp >= 0) {
+        if (tp == 16) {
+            return false;
+        }
+        // move what followed "::" to the end, the gap is left zeroed
+        const int moved = tp - colonp;
+        for (int j = 1; j <= moved; ++j) {
+            tmp[16 - j] = tmp[colonp + moved - j];
+            tmp[colonp + moved - j] = 0;
+        }
+        tp = 16;
+    }
+    if (tp != 16) {
+        return false;
+    }
+    std::memcpy(out, tmp, 16);
+    return true;
+}
+
+char *formatIPv4(const quint8 *bytes, char *out)
+{
+    for (int i = 0; i < 4; ++i) {
+        if (i) {
+            *out++ = '.';
+        }
+        const uint octet = bytes[i];
+        if (octet >= 100) {
+            *out++ = char('0' + octet / 100);
+        }
+        if (octet >= 10) {
+            *out++ = char('0' + octet / 10 % 10);
+        }
+        *out++ = char('0' + octet % 10);
+    }
+    return out;
+}
+
+char *formatHex(uint word, char *out)
+{
+    static const char digits[] = "0123456789abcdef";
+    bool leading = true;
+    for (int shift = 12; shift >= 0; shift -= 4) {
+        const uint nibble = (word >> shift) & 0xf;
+        if (leading && nibble == 0 && shift) {
+            continue;
+        }
+        leading = false;
+        *out++ = digits[nibble];
+    }
+    return out;
+}
+
+// RFC 5952 and the special cases of QHostAddress::toString() for embedded IPv4
+char *formatIPv6(const quint8 *bytes, char *out)
+{
+    static const quint8 zeroes[10] = {};
+    bool embeddedIPv4 = false;
+    if (std::memcmp(bytes, zeroes, 10) == 0) {
+        if (bytes[10] == 0xff && bytes[11] == 0xff) {
+            embeddedIPv4 = true;
+        } else if (bytes[10] == 0 && bytes[11] == 0) {
+            if (bytes[12] != 0 || bytes[13] != 0 || bytes[14] != 0) {
+                embeddedIPv4 = true;
+            } else if (bytes[15] == 0) {
+                *out++ = ':';
+                *out++ = ':';
+                return out;
+            }
+        }
+    }
+
+    const int words = embeddedIPv4 ? 6 : 8;
+    int runStart = -1;
+    int runLength = 0;
+    for (int i = 0; i < words;) {
+        if (bytes[2 * i] || bytes[2 * i + 1]) {
+            ++i;
+            continue;
+        }
+        int j = i;
+        while (j < words && !bytes[2 * j] && !bytes[2 * j + 1]) {
+            ++j;
+        }
+        if (j - i > runLength) {
+            runStart = i;
+            runLength = j - i;
+        }
+        i = j;
+    }
+    if (runLength < 2) {
+        runStart = -1;
+    }
+
+    for (int i = 0; i < words; ++i) {
+        if (i == runStart) {
+            *out++ = ':';
+            if (i == 0) {
+                *out++ = ':';
+            }
+            i += runLength - 1;
+            continue;
+        }
+        out = formatHex(uint(bytes[2 * i]) << 8 | bytes[2 * i + 1], out);
+        if (i + 1 < words) {
+            *out++ = ':';
+        }
+    }
+    if (embeddedIPv4) {
+        if (runStart + runLength != words) {
+            *out++ = ':';
+        }
+        out = formatIPv4(bytes + 12, out);
+    }
+    return out;
+}
+}
+
+NetworkManager::CompactIp NetworkManager::CompactIp::fromIPv4(quint32 address)
+{
+    CompactIp ip;
+    ip.family = IPv4;
+    ip.bytes[0] = quint8(address >> 24);
+    ip.bytes[1] = quint8(address >> 16);
+    ip.bytes[2] = quint8(address >> 8);
+    ip.bytes[3] = quint8(address);
+    return ip;
+}
+
+NetworkManager::CompactIp NetworkManager::CompactIp::fromIPv6(const quint8 *address)
+{
+    CompactIp ip;
+    ip.family = IPv6;
+    std::memcpy(ip.bytes, address, 16);
+    return ip;
+}
+
+NetworkManager::CompactIp NetworkManager::CompactIp::fromHostAddress(const QHostAddress &address)
+{
+    switch (address.protocol()) {
+    case QAbstractSocket::IPv4Protocol:
+        return fromIPv4(address.toIPv4Address());
+    case QAbstractSocket::IPv6Protocol: {
+        const Q_IPV6ADDR ipv6 = address.toIPv6Address();
+        return fromIPv6(ipv6.c);
+    }
+    default:
+        return CompactIp();
+    }
+}
+
+NetworkManager::CompactIp NetworkManager::CompactIp::fromString(QStringView text)
+{
+    CompactIp ip;
+    if (text.contains(QLatin1Char(':'))) {
+        if (parseIPv6(text, ip.bytes)) {
+            ip.family = IPv6;
+        }
+    } else if (parseIPv4(text, ip.bytes)) {
+        ip.family = IPv4;
+    }
+    return ip;
+}
+
+bool NetworkManager::CompactIp::isUnspecified() const
+{
+    if (family == Invalid) {
+        return false;
+    }
+    const int size = family == IPv4 ? 4 : 16;
+    for (int i = 0; i < size; ++i) {
+        if (bytes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+quint32 NetworkManager::CompactIp::toIPv4() const
+{
+    if (family != IPv4) {
+        return 0;
+    }
+    return quint32(bytes[0]) << 24 | quint32(bytes[1]) << 16 | quint32(bytes[2]) << 8 | quint32(bytes[3]);
+}
+
+QHostAddress NetworkManager::CompactIp::toHostAddress() const
+{
+    switch (family) {
+    case IPv4:
+        return QHostAddress(toIPv4());
+    case IPv6:
+        return QHostAddress(bytes);
+    default:
+        return QHostAddress();
+    }
+}
+
+int NetworkManager::CompactIp::format(char *buffer) const
+{
+    char *end = buffer;
+    if (family == IPv4) {
+        end = formatIPv4(bytes, buffer);
+    } else if (family == IPv6) {
+        end = formatIPv6(bytes, buffer);
+    }
+    *end = '\0';
+    return int(end - buffer);
+}
+
+QString NetworkManager::CompactIp::toString() const
+{
+    char buffer[MaxStringLength];
+    const int length = format(buffer);
+    return QString::fromLatin1(buffer, length);
+}
@@ -0,0 +1,131 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_COMPACTIP_H
+#define NETWORKMANAGERQT_COMPACTIP_H
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include <QHostAddress>
+#include <QList>
+#include <QStringView>
+
+namespace NetworkManager
+{
+/**
+ * Trivially copyable IPv4 or IPv6 address.
+ *
+ * Unlike QHostAddress it owns no heap memory, so lists of it are stored
+ * contiguously and parsing or formatting one doesn't allocate. IpAddress
+ * and IpRoute convert from and to the compact types.
+ *
+ * @since 5.94.0
+ */
+struct NETWORKMANAGERQT_EXPORT CompactIp {
+    enum Family : quint8 {
+        Invalid = 0,
+        IPv4 = 4,
+        IPv6 = 6,
+    };
+
+    /**
+     * Size of the buffer format() needs, including the terminating NUL
+     */
+    static constexpr int MaxStringLength = 46;
+
+    /**
+     * Address in network byte order, IPv4 uses the first four bytes
+     */
+    quint8 bytes[16] = {};
+    Family family = Invalid;
+
+    /**
+     * Returns the IPv4 address @p address given in host byte order
+     */
+    static CompactIp fromIPv4(quint32 address);
+    /**
+     * Returns the IPv6 address made of the 16 bytes at @p address
+     */
+    static CompactIp fromIPv6(const quint8 *address);
+    static CompactIp fromHostAddress(const QHostAddress &address);
+    /**
+     * Parses a textual IPv4 or IPv6 address, the result is Invalid if @p text isn't one
+     */
+    static CompactIp fromString(QStringView text);
+
+    bool isValid() const
+    {
+        return family != Invalid;
+    }
+    /**
+     * Returns true for 0.0.0.0 and ::
+     */
+    bool isUnspecified() const;
+    /**
+     * Returns the IPv4 address in host byte order, 0 for IPv6 addresses
+     */
+    quint32 toIPv4() const;
+    QHostAddress toHostAddress() const;
+
+    /**
+     * Writes the textual form of the address and a terminating NUL to @p buffer,
+     * which must hold at least MaxStringLength characters.
+     * @return the length of the text
+     */
+    int format(char *buffer) const;
+    QString toString() const;
+};
+
+inline bool operator==(const CompactIp &a, const CompactIp &b)
+{
+    if (a.family != b.family) {
+        return false;
+    }
+    const int size = a.family == CompactIp::IPv4 ? 4 : 16;
+    for (int i = 0; i < size; ++i) {
+        if (a.bytes[i] != b.bytes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool operator!=(const CompactIp &a, const CompactIp &b)
+{
+    return !(a == b);
+}
+
+/**
+ * Compact counterpart of IpAddress
+ * @since 5.94.0
+ */
+struct CompactIpAddress {
+    CompactIp address;
+    CompactIp gateway;
+    quint8 prefixLength = 0;
+};
+
+/**
+ * Compact counterpart of IpRoute
+ * @since 5.94.0
+ */
+struct CompactIpRoute {
+    CompactIp destination;
+    CompactIp nextHop;
+    quint32 metric = 0;
+    quint8 prefixLength = 0;
+};
+
+typedef QList<CompactIpAddress> CompactIpAddresses;
+typedef QList<CompactIpRoute> CompactIpRoutes;
+
+} // namespace NetworkManager
+
+Q_DECLARE_TYPEINFO(NetworkManager::CompactIp, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(NetworkManager::CompactIpAddress, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(NetworkManager::CompactIpRoute, Q_PRIMITIVE_TYPE);
+
+#endif // NETWORKMANAGERQT_COMPACTIP_H
@@ -13,6 +13,11 @@
 #include <libnm/NetworkManager.h>
 #define signals Q_SIGNALS
 
+#if !NM_CHECK_VERSION(1, 12, 0)
+#define NM_SETTINGS_UPDATE2_FLAG_TO_DISK 0x1
+#define NM_SETTINGS_UPDATE2_FLAG_IN_MEMORY 0x2
+#endif
+
 #include <QDBusConnection>
 #include <QDBusPendingCallWatcher>
 
@@ -113,6 +118,39 @@ QDBusPendingReply<> NetworkManager::Connection::updateUnsaved(const NMVariantMap
     return d->iface.UpdateUnsaved(settings);
 }
 
+QDBusPendingReply<QVariantMap> NetworkManager::Connection::update2(const NMVariantMapMap &settings, uint flags, const QVariantMap &args)
+{
+    Q_D(Connection);
+    return d->iface.Update2(settings, flags, args);
+}
+
+QDBusPendingReply<QVariantMap> NetworkManager::Connection::updateChanged(const ConnectionSettings::Ptr &settings, bool unsaved)
+{
+    Q_D(Connection);
+
+    // compare with the daemon's copy, settings() may be the very object the caller modified
+    const NMVariantMapMap newSettings = settings->toMap();
+    const NMVariantMapMap changes = ConnectionSettings::diff(ConnectionSettings(d->settings).toMap(), newSettings);
+    if (changes.isEmpty()) {
+        const QDBusMessage call = QDBusMessage::createMethodCall(d->iface.service(), d->path, d->iface.interface(), QStringLiteral("Update2"));
+        return QDBusPendingCall::fromCompletedCall(call.createReply(QVariant::fromValue(QVariantMap())));
+    }
+
+    // Update2 replaces the whole connection, so start from what the daemon has
+    // and only swap in the settings which changed
+    NMVariantMapMap merged = d->settings;
+    for (auto it = changes.constBegin(); it != changes.constEnd(); ++it) {
+        if (newSettings.contains(it.key())) {
+            merged.insert(it.key(), newSettings.value(it.key()));
+        } else {
+            merged.remove(it.key());
+        }
+    }
+
+    const uint flags = unsaved ? NM_SETTINGS_UPDATE2_FLAG_IN_MEMORY : NM_SETTINGS_UPDATE2_FLAG_TO_DISK;
+    return d->iface.Update2(merged, flags, QVariantMap());
+}
+
 QDBusPendingReply<> NetworkManager::Connection::save()
 {
     Q_D(Connection);
@@ -141,12 +179,11 @@ void NetworkManager::ConnectionPrivate::onConnectionUpdated()
 {
     Q_Q(Connection);
     QDBusReply<NMVariantMapMap> reply = iface.GetSettings();
-    if (reply.isValid()) {
-        updateSettings(reply.value());
-    } else {
-        updateSettings();
-    }
+    const NMVariantMapMap newSettings = reply.isValid() ? reply.value() : NMVariantMapMap();
+    const QStringList changedSettings = ConnectionSettings::diff(settings, newSettings).keys();
+    updateSettings(newSettings);
     Q_EMIT q->updated();
+    Q_EMIT q->settingsChanged(changedSettings);
 }
 
 void NetworkManager::ConnectionPrivate::onConnectionRemoved()
@@ -102,6 +102,29 @@ public:
      */
     QDBusPendingReply<> updateUnsaved(const NMVariantMapMap &settings);
 
+    /**
+     * Update the connection with new @p settings through the Update2 method.
+     * @p flags is a combination of NMSettingsUpdate2Flags and @p args holds
+     * the optional arguments of the call. The reply carries the result
+     * dictionary returned by NetworkManager.
+     *
+     * @since 5.94.0
+     */
+    QDBusPendingReply<QVariantMap> update2(const NMVariantMapMap &settings, uint flags, const QVariantMap &args = QVariantMap());
+
+    /**
+     * Update the connection to @p settings, replacing only the settings which differ
+     * from the ones currently stored by NetworkManager; everything else, including settings this library doesn't
+     * know about, is handed back to NetworkManager as it currently has it.
+     * Nothing is sent if there are no differences, the returned reply is
+     * then already finished.
+     *
+     * If @p unsaved is true the changes are not saved to disk, like updateUnsaved().
+     *
+     * @since 5.94.0
+     */
+    QDBusPendingReply<QVariantMap> updateChanged(const ConnectionSettings::Ptr &settings, bool unsaved = false);
+
     /**
      * Saves a "dirty" connection (that had previously been
      * updated with updateUnsaved()) to persistent storage.
@@ -130,6 +153,13 @@ Q_SIGNALS:
      */
     void updated();
 
+    /**
+     * Emitted together with updated()
+     * @param changedSettings names of the settings (e.g. "ipv4") which differ from the previous ones
+     * @since 5.94.0
+     */
+    void settingsChanged(const QStringList &changedSettings);
+
     /**
      * Emitted when the connection was removed
      * @param path connections's path.
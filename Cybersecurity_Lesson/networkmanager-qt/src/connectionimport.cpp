@@ -0,0 +1,209 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "connectionimport.h"
+#include "manager.h"
+#include "settings.h"
+
+#include <QDBusPendingCallWatcher>
+#include <QElapsedTimer>
+#include <QTimer>
+
+#include "nmdebug.h"
+
+namespace NetworkManager
+{
+class ConnectionImportPrivate
+{
+public:
+    explicit ConnectionImportPrivate(ConnectionImport *q);
+
+    QDBusPendingCall send(const NMVariantMapMap &map) const;
+    void sendNext();
+    void replied(int index, const QDBusPendingCall &call);
+
+    ConnectionSettings::List settings;
+    QList<ConnectionImport::Result> results;
+    // nsecsElapsed() of the timer when the call for each connection was sent
+    QList<qint64> sentAt;
+    ConnectionImport::Flags flags;
+    int maxInFlight;
+    int next;
+    int inFlight;
+    int completed;
+    int failed;
+    bool started;
+    QElapsedTimer timer;
+    qint64 elapsed;
+
+    Q_DECLARE_PUBLIC(ConnectionImport)
+    ConnectionImport *q_ptr;
+};
+}
+
+NetworkManager::ConnectionImportPrivate::ConnectionImportPrivate(ConnectionImport *q)
+    : flags(ConnectionImport::ToDisk)
+    , maxInFlight(8)
+    , next(0)
+    , inFlight(0)
+    , completed(0)
+    , failed(0)
+    , started(false)
+    , elapsed(-1)
+    , q_ptr(q)
+{
+}
+
+QDBusPendingCall NetworkManager::ConnectionImportPrivate::send(const NMVariantMapMap &map) const
+{
+    if (NetworkManager::checkVersion(1, 20, 0)) {
+        return addConnection2(map, flags.toInt());
+    } else if (flags.testFlag(ConnectionImport::InMemory)) {
+        return addConnectionUnsaved(map);
+    }
+    return addConnection(map);
+}
+
+void NetworkManager::ConnectionImportPrivate::sendNext()
+{
+    Q_Q(ConnectionImport);
+
+    while (inFlight < maxInFlight && next < settings.count()) {
+        const int index = next++;
+        const QDBusPendingCall call = send(settings.at(index)->toMap());
+        sentAt[index] = timer.nsecsElapsed();
+        ++inFlight;
+
+        auto watcher = new QDBusPendingCallWatcher(call, q);
+        QObject::connect(watcher, &QDBusPendingCallWatcher::finished, q, [this, index](QDBusPendingCallWatcher *watcher) {
+            watcher->deleteLater();
+            replied(index, *watcher);
+        });
+    }
+}
+
+void NetworkManager::ConnectionImportPrivate::replied(int index, const QDBusPendingCall &call)
+{
+    Q_Q(ConnectionImport);
+
+    ConnectionImport::Result &result = results[index];
+    result.latency = (timer.nsecsElapsed() - sentAt.at(index)) / 1000;
+    if (call.isError()) {
+        result.error = call.error().message();
+        ++failed;
+        qCWarning(NMQT) << "Failed to add connection" << settings.at(index)->uuid() << result.error;
+    } else {
+        // AddConnection and AddConnection2 both reply with the path first
+        result.path = call.reply().arguments().value(0).value<QDBusObjectPath>().path();
+    }
+    --inFlight;
+    ++completed;
+
+    Q_EMIT q->itemFinished(index);
+    Q_EMIT q->progress(completed, settings.count());
+
+    if (completed == settings.count()) {
+        elapsed = timer.elapsed();
+        Q_EMIT q->finished();
+    } else {
+        sendNext();
+    }
+}
+
+NetworkManager::ConnectionImport::ConnectionImport(const ConnectionSettings::List &settings, QObject *parent)
+    : QObject(parent)
+    , d_ptr(new ConnectionImportPrivate(this))
+{
+    Q_D(ConnectionImport);
+    d->settings = settings;
+    d->results.resize(settings.count());
+    d->sentAt.resize(settings.count());
+}
+
+NetworkManager::ConnectionImport::~ConnectionImport()
+{
+    delete d_ptr;
+}
+
+int NetworkManager::ConnectionImport::maxInFlight() const
+{
+    Q_D(const ConnectionImport);
+    return d->maxInFlight;
+}
+
+void NetworkManager::ConnectionImport::setMaxInFlight(int maxInFlight)
+{
+    Q_D(ConnectionImport);
+    d->maxInFlight = qMax(1, maxInFlight);
+    if (d->started) {
+        d->sendNext();
+    }
+}
+
+NetworkManager::ConnectionImport::Flags NetworkManager::ConnectionImport::flags() const
+{
+    Q_D(const ConnectionImport);
+    return d->flags;
+}
+
+void NetworkManager::ConnectionImport::setFlags(Flags flags)
+{
+    Q_D(ConnectionImport);
+    d->flags = flags;
+}
+
+void NetworkManager::ConnectionImport::start()
+{
+    Q_D(ConnectionImport);
+    if (d->started) {
+        return;
+    }
+    d->started = true;
+    d->timer.start();
+
+    if (d->settings.isEmpty()) {
+        d->elapsed = 0;
+        QTimer::singleShot(0, this, &ConnectionImport::finished);
+        return;
+    }
+    d->sendNext();
+}
+
+int NetworkManager::ConnectionImport::count() const
+{
+    Q_D(const ConnectionImport);
+    return d->settings.count();
+}
+
+int NetworkManager::ConnectionImport::completedCount() const
+{
+    Q_D(const ConnectionImport);
+    return d->completed;
+}
+
+int NetworkManager::ConnectionImport::failedCount() const
+{
+    Q_D(const ConnectionImport);
+    return d->failed;
+}
+
+bool NetworkManager::ConnectionImport::isFinished() const
+{
+    Q_D(const ConnectionImport);
+    return d->started && d->completed == d->settings.count();
+}
+
+QList<NetworkManager::ConnectionImport::Result> NetworkManager::ConnectionImport::results() const
+{
+    Q_D(const ConnectionImport);
+    return d->results;
+}
+
+qint64 NetworkManager::ConnectionImport::elapsed() const
+{
+    Q_D(const ConnectionImport);
+    return d->elapsed;
+}
@@ -0,0 +1,138 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_CONNECTION_IMPORT_H
+#define NETWORKMANAGERQT_CONNECTION_IMPORT_H
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include "connectionsettings.h"
+
+#include <QObject>
+
+namespace NetworkManager
+{
+class ConnectionImportPrivate;
+
+/**
+ * Adds a batch of connections to NetworkManager.
+ *
+ * Instead of waiting for each reply in turn, up to maxInFlight() AddConnection2
+ * calls are kept pending at the same time, so importing many profiles is bound
+ * by the throughput of the bus rather than by its round trip time.
+ * With NetworkManager older than 1.20 AddConnection or AddConnectionUnsaved
+ * is used instead and the BlockAutoconnect flag has no effect.
+ *
+ * @since 5.94.0
+ */
+class NETWORKMANAGERQT_EXPORT ConnectionImport : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count CONSTANT)
+    Q_PROPERTY(int completedCount READ completedCount NOTIFY progress)
+
+public:
+    /**
+     * Flags passed to AddConnection2, see NMSettingsAddConnection2Flags
+     */
+    enum Flag {
+        None = 0,
+        ToDisk = 0x1,
+        InMemory = 0x2,
+        BlockAutoconnect = 0x20,
+    };
+    Q_DECLARE_FLAGS(Flags, Flag)
+    Q_FLAG(Flags)
+
+    /**
+     * Outcome of adding a single connection
+     */
+    struct Result {
+        /**
+         * Object path of the new connection, empty if it wasn't added
+         */
+        QString path;
+        /**
+         * Error returned by NetworkManager
+         */
+        QString error;
+        /**
+         * Time between sending the call and receiving its reply in microseconds, -1 while pending
+         */
+        qint64 latency = -1;
+    };
+
+    explicit ConnectionImport(const ConnectionSettings::List &settings, QObject *parent = nullptr);
+    ~ConnectionImport() override;
+
+    /**
+     * Maximum number of calls pending at the same time, 8 by default
+     */
+    int maxInFlight() const;
+    void setMaxInFlight(int maxInFlight);
+
+    /**
+     * Flags used for every connection, ToDisk by default
+     */
+    Flags flags() const;
+    void setFlags(Flags flags);
+
+    /**
+     * Starts sending the connections, has no effect if already started
+     */
+    void start();
+
+    /**
+     * Returns the number of connections to add
+     */
+    int count() const;
+    /**
+     * Returns the number of connections NetworkManager replied for so far
+     */
+    int completedCount() const;
+    /**
+     * Returns the number of connections which failed to be added
+     */
+    int failedCount() const;
+    /**
+     * Returns @p true once every connection got its reply
+     */
+    bool isFinished() const;
+
+    /**
+     * Returns the results in the order of the connections passed to the constructor
+     */
+    QList<Result> results() const;
+
+    /**
+     * Returns the time in milliseconds from start() to the last reply, -1 until finished
+     */
+    qint64 elapsed() const;
+
+Q_SIGNALS:
+    /**
+     * Emitted when the reply for the connection at @p index arrived
+     */
+    void itemFinished(int index);
+    /**
+     * Emitted after each reply with the number of @p completed connections out of @p total
+     */
+    void progress(int completed, int total);
+    /**
+     * Emitted once every connection got its reply
+     */
+    void finished();
+
+private:
+    Q_DECLARE_PRIVATE(ConnectionImport)
+    ConnectionImportPrivate *const d_ptr;
+};
+
+}
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(NetworkManager::ConnectionImport::Flags)
+
+#endif // NETWORKMANAGERQT_CONNECTION_IMPORT_H
@@ -90,6 +90,13 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("Update"), argumentList);
     }
 
+    inline QDBusPendingReply<QVariantMap> Update2(NMVariantMapMap settings, uint flags, const QVariantMap &args)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(settings) << QVariant::fromValue(flags) << QVariant::fromValue(args);
+        return asyncCallWithArgumentList(QStringLiteral("Update2"), argumentList);
+    }
+
     inline QDBusPendingReply<> UpdateUnsaved(NMVariantMapMap properties)
     {
         QList<QVariant> argumentList;
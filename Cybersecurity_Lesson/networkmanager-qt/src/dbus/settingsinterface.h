@@ -69,6 +69,13 @@ public Q_SLOTS: // METHODS
         return asyncCallWithArgumentList(QStringLiteral("AddConnection"), argumentList);
     }
 
+    inline QDBusPendingReply<QDBusObjectPath, QVariantMap> AddConnection2(NMVariantMapMap settings, uint flags, const QVariantMap &args)
+    {
+        QList<QVariant> argumentList;
+        argumentList << QVariant::fromValue(settings) << QVariant::fromValue(flags) << QVariant::fromValue(args);
+        return asyncCallWithArgumentList(QStringLiteral("AddConnection2"), argumentList);
+    }
+
     inline QDBusPendingReply<QDBusObjectPath> AddConnectionUnsaved(NMVariantMapMap connection)
     {
         QList<QVariant> argumentList;
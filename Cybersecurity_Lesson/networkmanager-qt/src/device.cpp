@@ -104,6 +104,10 @@ void NetworkManager::DevicePrivate::init()
     qDBusRegisterMetaType<IpV6DBusRoute>();
     qDBusRegisterMetaType<IpV6DBusRouteList>();
     qDBusRegisterMetaType<DeviceDBusStateReason>();
+    qDBusRegisterMetaType<NMAddressData>();
+    qDBusRegisterMetaType<NMAddressDataList>();
+    qDBusRegisterMetaType<NMRouteData>();
+    qDBusRegisterMetaType<NMRouteDataList>();
 
     // This needs to be initialized as soon as possible, because based on this property
     // we initialize the device type
@@ -234,25 +238,43 @@ void NetworkManager::DevicePrivate::propertyChanged(const QString &property, con
         autoconnect = value.toBool();
         Q_EMIT q->autoconnectChanged();
     } else if (property == QLatin1String("AvailableConnections")) {
-        QStringList newAvailableConnections;
         const QList<QDBusObjectPath> availableConnectionsTmp = qdbus_cast<QList<QDBusObjectPath>>(value);
+        QSet<QString> newAvailableConnections;
+        newAvailableConnections.reserve(availableConnectionsTmp.size());
+        QStringList appeared;
         for (const QDBusObjectPath &availableConnection : availableConnectionsTmp) {
-            newAvailableConnections << availableConnection.path();
-            if (!availableConnections.contains(availableConnection.path())) {
-                availableConnections << availableConnection.path();
-                Q_EMIT q->availableConnectionAppeared(availableConnection.path());
+            const QString path = availableConnection.path();
+            newAvailableConnections.insert(path);
+            if (!availableConnectionSet.contains(path)) {
+                appeared << path;
             }
         }
-        auto it = availableConnections.begin();
-        while (it != availableConnections.end()) {
-            const QString availableConnection = *it;
-            if (!newAvailableConnections.contains(availableConnection)) {
-                it = availableConnections.erase(it);
-                Q_EMIT q->availableConnectionDisappeared(availableConnection);
-            } else {
-                ++it;
+        QStringList disappeared;
+        if (newAvailableConnections.size() - appeared.size() != availableConnectionSet.size()) {
+            for (const QString &availableConnection : std::as_const(availableConnections)) {
+                if (!newAvailableConnections.contains(availableConnection)) {
+                    disappeared << availableConnection;
+                }
             }
         }
+        if (appeared.isEmpty() && disappeared.isEmpty()) {
+            return;
+        }
+
+        if (!disappeared.isEmpty()) {
+            availableConnections.removeIf([&newAvailableConnections](const QString &availableConnection) {
+                return !newAvailableConnections.contains(availableConnection);
+            });
+        }
+        availableConnections << appeared;
+        availableConnectionSet = newAvailableConnections;
+
+        for (const QString &availableConnection : std::as_const(appeared)) {
+            Q_EMIT q->availableConnectionAppeared(availableConnection);
+        }
+        for (const QString &availableConnection : std::as_const(disappeared)) {
+            Q_EMIT q->availableConnectionDisappeared(availableConnection);
+        }
         Q_EMIT q->availableConnectionChanged();
     } else if (property == QLatin1String("Capabilities")) {
         capabilities = NetworkManager::DevicePrivate::convertCapabilities(value.toUInt());
@@ -330,7 +352,6 @@ void NetworkManager::DevicePrivate::propertyChanged(const QString &property, con
             activeConnection = QLatin1Char('/');
             Q_EMIT q->activeConnectionChanged();
         }
-        Q_EMIT q->connectionStateChanged();
     } else if (property == QLatin1String("StateReason")) { // just extracting the reason
         reason = NetworkManager::DevicePrivate::convertReason(qdbus_cast<DeviceDBusStateReason>(value).reason);
         Q_EMIT q->stateReasonChanged();
@@ -417,6 +438,24 @@ NetworkManager::Connection::List NetworkManager::Device::availableConnections()
     return list;
 }
 
+QStringList NetworkManager::Device::availableConnectionPaths() const
+{
+    Q_D(const Device);
+    return d->availableConnections;
+}
+
+int NetworkManager::Device::availableConnectionCount() const
+{
+    Q_D(const Device);
+    return d->availableConnections.count();
+}
+
+bool NetworkManager::Device::isConnectionAvailable(const QString &connectionPath) const
+{
+    Q_D(const Device);
+    return d->availableConnectionSet.contains(connectionPath);
+}
+
 bool NetworkManager::Device::firmwareMissing() const
 {
     Q_D(const Device);
@@ -564,6 +603,18 @@ NetworkManager::Device::State NetworkManager::Device::state() const
     return d->connectionState;
 }
 
+QBindable<NetworkManager::Device::State> NetworkManager::Device::bindableState()
+{
+    Q_D(Device);
+    return &d->connectionState;
+}
+
+QList<NetworkManager::Device::StateTransition> NetworkManager::Device::stateTransitions() const
+{
+    Q_D(const Device);
+    return d->stateTransitions;
+}
+
 int NetworkManager::Device::designSpeed() const
 {
     Q_D(const Device);
@@ -588,13 +639,28 @@ NetworkManager::DeviceStatistics::Ptr NetworkManager::Device::deviceStatistics()
     return d->deviceStatistics;
 }
 
+void NetworkManager::DevicePrivate::connectionStateNotify()
+{
+    Q_Q(Device);
+    Q_EMIT q->connectionStateChanged();
+}
+
 void NetworkManager::DevicePrivate::deviceStateChanged(uint newState, uint oldState, uint reason)
 {
     Q_Q(Device);
     connectionState = NetworkManager::DevicePrivate::convertState(newState);
     reason = NetworkManager::DevicePrivate::convertReason(reason);
 
-    Q_EMIT q->stateChanged(connectionState, NetworkManager::DevicePrivate::convertState(oldState), NetworkManager::DevicePrivate::convertReason(reason));
+    if (stateTransitions.size() >= 64) {
+        stateTransitions.removeFirst();
+    }
+    stateTransitions.append({NetworkManagerPrivate::monotonicTimestamp(),
+                             NetworkManager::DevicePrivate::convertState(oldState),
+                             connectionState.value(),
+                             NetworkManager::DevicePrivate::convertReason(reason)});
+
+    NetworkManagerPrivate::journal(JournalEvent::DeviceStateChanged, uni, uni);
+    Q_EMIT q->stateChanged(connectionState.value(), NetworkManager::DevicePrivate::convertState(oldState), NetworkManager::DevicePrivate::convertReason(reason));
 }
 
 void NetworkManager::DevicePrivate::dbusPropertiesChanged(const QString &interfaceName, const QVariantMap &properties, const QStringList &invalidatedProperties)
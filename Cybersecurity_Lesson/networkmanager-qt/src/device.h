@@ -11,6 +11,7 @@
 #define NETWORKMANAGERQT_DEVICE_H
 
 #include <QObject>
+#include <QProperty>
 #include <QSharedPointer>
 
 #include "activeconnection.h"
@@ -50,7 +51,7 @@ class NETWORKMANAGERQT_EXPORT Device : public QObject
     Q_PROPERTY(bool firmwareMissing READ firmwareMissing)
     Q_PROPERTY(bool autoconnect READ autoconnect WRITE setAutoconnect)
     Q_PROPERTY(DeviceStateReason stateReason READ stateReason)
-    Q_PROPERTY(State state READ state)
+    Q_PROPERTY(State state READ state NOTIFY connectionStateChanged BINDABLE bindableState)
     Q_PROPERTY(NetworkManager::DeviceStatistics::Ptr deviceStatistics READ deviceStatistics)
 
 public:
@@ -212,6 +213,20 @@ public:
     Q_DECLARE_FLAGS(Types, Type)
     Q_FLAG(Types)
 
+    /**
+     * A state change of the device
+     * @since 5.94.0
+     */
+    struct StateTransition {
+        /**
+         * Microseconds of the monotonic clock, comparable with ActiveConnection::StateTransition::timestamp
+         */
+        qint64 timestamp;
+        State oldState;
+        State newState;
+        StateChangeReason reason;
+    };
+
     /**
      * Creates a new device object.
      *
@@ -249,6 +264,25 @@ public:
      * @returns List of availables connection
      */
     Connection::List availableConnections();
+    /**
+     * Returns the object paths of the connections available for this device.
+     *
+     * Unlike availableConnections() no Connection objects are created, so
+     * nothing is fetched from NetworkManager.
+     * @since 5.94.0
+     */
+    QStringList availableConnectionPaths() const;
+    /**
+     * Returns the number of connections available for this device
+     * @since 5.94.0
+     */
+    int availableConnectionCount() const;
+    /**
+     * Returns @p true if the connection with the object path @p connectionPath
+     * is available for this device, the lookup takes constant time.
+     * @since 5.94.0
+     */
+    bool isConnectionAvailable(const QString &connectionPath) const;
     /**
      * The system name for the network device
      */
@@ -344,6 +378,17 @@ public:
      * @see Device::State
      */
     State state() const;
+    /**
+     * Bindable counterpart of state()
+     * @since 5.94.0
+     */
+    QBindable<State> bindableState();
+    /**
+     * Returns the most recent state changes of the device, oldest first.
+     * At most the last 64 changes are kept.
+     * @since 5.94.0
+     */
+    QList<StateTransition> stateTransitions() const;
     /**
      * Retrieves the maximum speed as reported by the device.
      * Note that this is only a design related piece of information, and that
@@ -10,6 +10,8 @@
 #include "dbus/deviceinterface.h"
 #include "device.h"
 
+#include <QSet>
+
 namespace NetworkManager
 {
 class NetworkManagerPrivate;
@@ -30,7 +32,11 @@ public:
     QString activeConnection;
     int designSpeed;
     Device::Type deviceType;
-    Device::State connectionState;
+    // emits Device::connectionStateChanged() whenever connectionState changes, however it is set
+    void connectionStateNotify();
+    Q_OBJECT_BINDABLE_PROPERTY_WITH_ARGS(DevicePrivate, Device::State, connectionState, Device::UnknownState, &DevicePrivate::connectionStateNotify)
+    // bounded history of state changes, see Device::stateTransitions()
+    QList<Device::StateTransition> stateTransitions;
     bool managed;
     mutable IpConfig ipV4Config;
     QString ipV4ConfigPath;
@@ -48,6 +54,8 @@ public:
     QString driverVersion;
     QString firmwareVersion;
     QStringList availableConnections;
+    // the same paths as availableConnections, for membership queries
+    QSet<QString> availableConnectionSet;
     bool autoconnect;
     Device::StateChangeReason reason;
     QString physicalPortId;
@@ -0,0 +1,419 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "devicematcher.h"
+
+#include <QSet>
+
+namespace
+{
+// A single element of a pattern list, compiled to the cheapest way of matching it
+class Glob
+{
+public:
+    enum Kind {
+        Literal,
+        Prefix,
+        Suffix,
+        Everything,
+        Generic,
+    };
+
+    explicit Glob(QStringView pattern);
+
+    bool matches(QStringView text) const;
+
+    Kind kind;
+    // the text for Literal, Prefix and Suffix
+    QString text;
+
+private:
+    struct Token {
+        enum Type : quint8 {
+            Char,
+            AnyChar,
+            Star,
+            Class,
+        };
+        Type type;
+        char16_t c;
+        int charClass;
+    };
+
+    struct CharClass {
+        QList<QPair<char16_t, char16_t>> ranges;
+        bool negated = false;
+
+        bool contains(char16_t c) const
+        {
+            for (const auto &range : ranges) {
+                if (c >= range.first && c <= range.second) {
+                    return !negated;
+                }
+            }
+            return negated;
+        }
+    };
+
+    qsizetype parseClass(QStringView pattern, qsizetype start);
+    bool tokenMatches(const Token &token, char16_t c) const;
+
+    QList<Token> m_tokens;
+    QList<CharClass> m_classes;
+};
+
+Glob::Glob(QStringView pattern)
+{
+    for (qsizetype i = 0; i < pattern.size(); ++i) {
+        const char16_t c = pattern.at(i).unicode();
+        if (c == u'\\' && i + 1 < pattern.size()) {
+            m_tokens << Token{Token::Char, pattern.at(++i).unicode(), -1};
+        } else if (c == u'*') {
+            if (m_tokens.isEmpty() || m_tokens.constLast().type != Token::Star) {
+                m_tokens << Token{Token::Star, c, -1};
+            }
+        } else if (c == u'?') {
+            m_tokens << Token{Token::AnyChar, c, -1};
+        } else if (c == u'[') {
+            const qsizetype end = parseClass(pattern, i);
+            if (end < 0) {
+                m_tokens << Token{Token::Char, c, -1};
+            } else {
+                m_tokens << Token{Token::Class, c, int(m_classes.size() - 1)};
+                i = end;
+            }
+        } else {
+            m_tokens << Token{Token::Char, c, -1};
+        }
+    }
+
+    int stars = 0;
+    bool plain = true;
+    for (const Token &token : std::as_const(m_tokens)) {
+        if (token.type == Token::Star) {
+            ++stars;
+        } else if (token.type != Token::Char) {
+            plain = false;
+        }
+    }
+
+    auto charsOf = [this](qsizetype from, qsizetype to) {
+        QString chars;
+        chars.reserve(to - from);
+        for (qsizetype i = from; i < to; ++i) {
+            chars.append(QChar(m_tokens.at(i).c));
+        }
+        return chars;
+    };
+
+    kind = Generic;
+    if (plain && stars == 0) {
+        kind = Literal;
+        text = charsOf(0, m_tokens.size());
+    } else if (plain && stars == 1 && m_tokens.size() == 1) {
+        kind = Everything;
+    } else if (plain && stars == 1 && m_tokens.constLast().type == Token::Star) {
+        kind = Prefix;
+        text = charsOf(0, m_tokens.size() - 1);
+    } else if (plain && stars == 1 && m_tokens.constFirst().type == Token::Star) {
+        kind = Suffix;
+        text = charsOf(1, m_tokens.size());
+    }
+    if (kind != Generic) {
+        m_tokens.clear();
+    }
+}
+
+// Parses the bracket expression starting at @p start, returns the index of its closing bracket or -1
+qsizetype Glob::parseClass(QStringView pattern, qsizetype start)
+{
+    CharClass charClass;
+    qsizetype i = start + 1;
+    if (i < pattern.size() && (pattern.at(i) == QLatin1Char('!') || pattern.at(i) == QLatin1Char('^'))) {
+        charClass.negated = true;
+        ++i;
+    }
+
+    const qsizetype first = i;
+    for (; i < pattern.size(); ++i) {
+        char16_t c = pattern.at(i).unicode();
+        if (c == u']' && i > first) {
+            m_classes << charClass;
+            return i;
+        }
+        if (c == u'\\' && i + 1 < pattern.size()) {
+            c = pattern.at(++i).unicode();
+        }
+        char16_t last = c;
+        if (i + 2 < pattern.size() && pattern.at(i + 1) == QLatin1Char('-') && pattern.at(i + 2) != QLatin1Char(']')) {
+            i += 2;
+            last = pattern.at(i).unicode();
+            if (last == u'\\' && i + 1 < pattern.size()) {
+                last = pattern.at(++i).unicode();
+            }
+        }
+        charClass.ranges << qMakePair(c, last);
+    }
+    return -1;
+}
+
+bool Glob::tokenMatches(const Token &token, char16_t c) const
+{
+    switch (token.type) {
+    case Token::Char:
+        return token.c == c;
+    case Token::AnyChar:
+        return true;
+    case Token::Class:
+        return m_classes.at(token.charClass).contains(c);
+    case Token::Star:
+        break;
+    }
+    return false;
+}
+
+bool Glob::matches(QStringView name) const
+{
+    switch (kind) {
+    case Literal:
+        return name == text;
+    case Prefix:
+        return name.startsWith(text);
+    case Suffix:
+        return name.endsWith(text);
+    case Everything:
+        return true;
+    case Generic:
+        break;
+    }
+
+    // on a mismatch resume after the last star, consuming one more character with it
+    qsizetype token = 0;
+    qsizetype pos = 0;
+    qsizetype starToken = -1;
+    qsizetype starPos = 0;
+    while (pos < name.size()) {
+        if (token < m_tokens.size() && m_tokens.at(token).type == Token::Star) {
+            starToken = token++;
+            starPos = pos;
+        } else if (token < m_tokens.size() && tokenMatches(m_tokens.at(token), name.at(pos).unicode())) {
+            ++token;
+            ++pos;
+        } else if (starToken >= 0) {
+            token = starToken + 1;
+            pos = ++starPos;
+        } else {
+            return false;
+        }
+    }
+    while (token < m_tokens.size() && m_tokens.at(token).type == Token::Star) {
+        ++token;
+    }
+    return token == m_tokens.size();
+}
+
+struct Element {
+    Glob glob;
+    bool inverted;
+};
+
+// A compiled pattern list with the NetworkManager "|", "&" and "!" semantics
+class PatternList
+{
+public:
+    PatternList() = default;
+    explicit PatternList(const QStringList &patterns);
+
+    bool isEmpty() const
+    {
+        return m_mandatory.isEmpty() && !m_hasOptional;
+    }
+    bool matches(const QString &text) const;
+
+private:
+    QList<Element> m_mandatory;
+    // optional elements which are neither plain names nor inverted
+    QList<Element> m_optional;
+    QSet<QString> m_optionalNames;
+    bool m_hasOptional = false;
+};
+
+PatternList::PatternList(const QStringList &patterns)
+{
+    for (const QString &pattern : patterns) {
+        QStringView element(pattern);
+        bool mandatory = false;
+        bool explicitlyOptional = false;
+        bool inverted = false;
+        if (element.startsWith(QLatin1Char('&'))) {
+            mandatory = true;
+            element = element.mid(1);
+        } else if (element.startsWith(QLatin1Char('|'))) {
+            explicitlyOptional = true;
+            element = element.mid(1);
+        }
+        if (element.startsWith(QLatin1Char('!'))) {
+            inverted = true;
+            mandatory = mandatory || !explicitlyOptional;
+            element = element.mid(1);
+        }
+        if (element.startsWith(QLatin1Char('\\'))) {
+            element = element.mid(1);
+        }
+
+        Glob glob(element);
+        if (mandatory) {
+            m_mandatory << Element{glob, inverted};
+            continue;
+        }
+        m_hasOptional = true;
+        if (glob.kind == Glob::Literal && !inverted) {
+            m_optionalNames.insert(glob.text);
+        } else {
+            m_optional << Element{glob, inverted};
+        }
+    }
+}
+
+bool PatternList::matches(const QString &text) const
+{
+    for (const Element &element : m_mandatory) {
+        if (element.glob.matches(text) == element.inverted) {
+            return false;
+        }
+    }
+    if (!m_hasOptional || m_optionalNames.contains(text)) {
+        return true;
+    }
+    for (const Element &element : m_optional) {
+        if (element.glob.matches(text) != element.inverted) {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+class NetworkManager::DeviceMatcher::Private
+{
+public:
+    PatternList interfaceNames;
+    PatternList drivers;
+    // connection.interface-name, it has to be equal when set
+    QString interfaceName;
+};
+
+NetworkManager::DeviceMatcher::Candidate NetworkManager::DeviceMatcher::Candidate::fromDevice(const Device::Ptr &device)
+{
+    Candidate candidate;
+    if (device) {
+        candidate.interfaceName = device->interfaceName();
+        candidate.driver = device->driver();
+    }
+    return candidate;
+}
+
+NetworkManager::DeviceMatcher::DeviceMatcher()
+    : d(new Private)
+{
+}
+
+NetworkManager::DeviceMatcher::DeviceMatcher(const QStringList &interfaceNamePatterns, const QStringList &driverPatterns)
+    : d(new Private)
+{
+    d->interfaceNames = PatternList(interfaceNamePatterns);
+    d->drivers = PatternList(driverPatterns);
+}
+
+NetworkManager::DeviceMatcher::DeviceMatcher(const MatchSetting &setting)
+    : DeviceMatcher(setting.interfaceName(), setting.driver())
+{
+}
+
+NetworkManager::DeviceMatcher::DeviceMatcher(const ConnectionSettings::Ptr &settings)
+    : d(new Private)
+{
+    if (!settings) {
+        return;
+    }
+
+    d->interfaceName = settings->interfaceName();
+    const MatchSetting::Ptr match = settings->setting(Setting::Match).staticCast<MatchSetting>();
+    if (match && !match->isNull()) {
+        d->interfaceNames = PatternList(match->interfaceName());
+        d->drivers = PatternList(match->driver());
+    }
+}
+
+NetworkManager::DeviceMatcher::DeviceMatcher(const DeviceMatcher &other)
+    : d(new Private)
+{
+    *this = other;
+}
+
+NetworkManager::DeviceMatcher::~DeviceMatcher()
+{
+    delete d;
+}
+
+NetworkManager::DeviceMatcher &NetworkManager::DeviceMatcher::operator=(const DeviceMatcher &other)
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    *d = *other.d;
+    return *this;
+}
+
+bool NetworkManager::DeviceMatcher::matchesAll() const
+{
+    return d->interfaceName.isEmpty() && d->interfaceNames.isEmpty() && d->drivers.isEmpty();
+}
+
+bool NetworkManager::DeviceMatcher::matches(const Candidate &candidate) const
+{
+    return matches(candidate.interfaceName, candidate.driver);
+}
+
+bool NetworkManager::DeviceMatcher::matches(const QString &interfaceName, const QString &driver) const
+{
+    if (!d->interfaceName.isEmpty() && d->interfaceName != interfaceName) {
+        return false;
+    }
+    return d->interfaceNames.matches(interfaceName) && d->drivers.matches(driver);
+}
+
+QBitArray NetworkManager::DeviceMatcher::matches(const QList<Candidate> &candidates) const
+{
+    QBitArray result(candidates.size(), matchesAll());
+    if (matchesAll()) {
+        return result;
+    }
+
+    for (int i = 0; i < candidates.size(); ++i) {
+        if (matches(candidates.at(i))) {
+            result.setBit(i);
+        }
+    }
+    return result;
+}
+
+QHash<QString, QList<int>> NetworkManager::DeviceMatcher::devicesForConnections(const ConnectionSettings::List &connections, const QList<Candidate> &devices)
+{
+    QHash<QString, QList<int>> result;
+    result.reserve(connections.size());
+    for (const ConnectionSettings::Ptr &connection : connections) {
+        const QBitArray matched = DeviceMatcher(connection).matches(devices);
+        QList<int> &indexes = result[connection->uuid()];
+        for (int i = 0; i < matched.size(); ++i) {
+            if (matched.testBit(i)) {
+                indexes << i;
+            }
+        }
+    }
+    return result;
+}
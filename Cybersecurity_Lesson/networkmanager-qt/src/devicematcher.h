@@ -0,0 +1,90 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_DEVICE_MATCHER_H
+#define NETWORKMANAGERQT_DEVICE_MATCHER_H
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include "connectionsettings.h"
+#include "device.h"
+#include "matchsetting.h"
+
+#include <QBitArray>
+#include <QHash>
+
+namespace NetworkManager
+{
+/**
+ * Evaluates on the client side which devices a connection profile may apply to.
+ *
+ * The interface name and driver pattern lists of a MatchSetting follow the
+ * NetworkManager semantics: each element is a shell wildcard pattern which
+ * can be prefixed with "|" (optional, the default) or "&" (mandatory) and
+ * inverted with "!". All mandatory elements must match and, if there are
+ * optional ones, at least one of them. "!foo" is short for "&!foo" and a
+ * backslash escapes the start of a pattern. An empty list matches anything.
+ *
+ * The patterns are compiled once when the matcher is constructed: plain
+ * names are looked up in a hash, prefix and suffix wildcards are compared
+ * directly and only the remaining patterns run the generic glob matcher.
+ *
+ * @since 5.94.0
+ */
+class NETWORKMANAGERQT_EXPORT DeviceMatcher
+{
+public:
+    /**
+     * Properties of a device the patterns are evaluated against
+     */
+    struct Candidate {
+        QString interfaceName;
+        QString driver;
+
+        static Candidate fromDevice(const Device::Ptr &device);
+    };
+
+    /**
+     * Constructs a matcher accepting every device
+     */
+    DeviceMatcher();
+    DeviceMatcher(const QStringList &interfaceNamePatterns, const QStringList &driverPatterns = QStringList());
+    explicit DeviceMatcher(const MatchSetting &setting);
+    /**
+     * Constructs a matcher for the connection @p settings, which also takes
+     * the interface name of the connection into account
+     */
+    explicit DeviceMatcher(const ConnectionSettings::Ptr &settings);
+    DeviceMatcher(const DeviceMatcher &other);
+    ~DeviceMatcher();
+
+    DeviceMatcher &operator=(const DeviceMatcher &other);
+
+    /**
+     * Returns @p true if the matcher has no restrictions
+     */
+    bool matchesAll() const;
+
+    bool matches(const Candidate &candidate) const;
+    bool matches(const QString &interfaceName, const QString &driver = QString()) const;
+    /**
+     * Evaluates each of @p candidates, bit i of the result is set if candidate i matched
+     */
+    QBitArray matches(const QList<Candidate> &candidates) const;
+
+    /**
+     * Maps the uuid of each of @p connections to the indexes of the @p devices it applies to
+     */
+    static QHash<QString, QList<int>> devicesForConnections(const ConnectionSettings::List &connections, const QList<Candidate> &devices);
+
+private:
+    class Private;
+    Private *const d;
+};
+
+}
+
+#endif // NETWORKMANAGERQT_DEVICE_MATCHER_H
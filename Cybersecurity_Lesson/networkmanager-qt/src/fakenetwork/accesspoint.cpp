@@ -115,6 +115,10 @@ void AccessPoint::setSsid(const QByteArray &ssid)
 void AccessPoint::setStrength(uchar strength)
 {
     m_strength = strength;
+
+    QVariantMap map;
+    map.insert(QLatin1String("Strength"), QVariant::fromValue(strength));
+    Q_EMIT PropertiesChanged(map);
 }
 
 void AccessPoint::setWpaFlags(uint flags)
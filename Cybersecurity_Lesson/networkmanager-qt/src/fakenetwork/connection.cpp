@@ -60,6 +60,18 @@ void Connection::Update(const NMVariantMapMap &properties)
     Q_EMIT Updated();
 }
 
+QVariantMap Connection::Update2(const NMVariantMapMap &settings, uint flags, const QVariantMap &args)
+{
+    Q_UNUSED(flags);
+    Q_UNUSED(args);
+
+    m_settings = settings;
+
+    Q_EMIT Updated();
+
+    return QVariantMap();
+}
+
 void Connection::UpdateUnsaved(const NMVariantMapMap &properties)
 {
     // TODO
@@ -35,6 +35,7 @@ public Q_SLOTS: // METHODS
     Q_SCRIPTABLE NMVariantMapMap GetSettings();
     Q_SCRIPTABLE void Save();
     Q_SCRIPTABLE void Update(const NMVariantMapMap &properties);
+    Q_SCRIPTABLE QVariantMap Update2(const NMVariantMapMap &settings, uint flags, const QVariantMap &args);
     Q_SCRIPTABLE void UpdateUnsaved(const NMVariantMapMap &properties);
 
 Q_SIGNALS:
@@ -31,6 +31,7 @@ FakeNetwork::FakeNetwork(QObject *parent)
     , m_wwanEnabled(true)
     , m_wwanHardwareEnabled(true)
     , m_activeConnectionsCounter(0)
+    , m_activationReplyDelay(0)
     , m_deviceCounter(0)
     , m_settings(new Settings(this))
 {
@@ -233,6 +234,14 @@ QDBusObjectPath FakeNetwork::ActivateConnection(const QDBusObjectPath &connectio
         QTimer::singleShot(100, this, SLOT(updateConnectingState()));
     }
 
+    if (m_activationReplyDelay > 0 && calledFromDBus()) {
+        setDelayedReply(true);
+        const QDBusMessage reply = message().createReply(QVariant::fromValue(QDBusObjectPath(newActiveConnectionPath)));
+        QTimer::singleShot(m_activationReplyDelay, this, [reply]() {
+            QDBusConnection::sessionBus().send(reply);
+        });
+    }
+
     return QDBusObjectPath(newActiveConnectionPath);
 }
 
@@ -464,6 +473,11 @@ void FakeNetwork::onConnectionRemoved(const QDBusObjectPath &connection)
     }
 }
 
+void FakeNetwork::setActivationReplyDelay(int msec)
+{
+    m_activationReplyDelay = msec;
+}
+
 void FakeNetwork::removeActiveConnection(const QDBusObjectPath &activeConnection)
 {
     delete m_activeConnections.value(activeConnection);
@@ -9,6 +9,7 @@
 
 #include <QObject>
 
+#include <QDBusContext>
 #include <QDBusObjectPath>
 
 #include "../device.h"
@@ -18,7 +19,7 @@
 #include "device.h"
 #include "settings.h"
 
-class FakeNetwork : public QObject
+class FakeNetwork : public QObject, protected QDBusContext
 {
     Q_OBJECT
     Q_CLASSINFO("D-Bus Interface", "org.kde.fakenetwork")
@@ -66,11 +67,13 @@ public:
     void removeDevice(Device *device);
     void registerService();
     void unregisterService();
+    void removeActiveConnection(const QDBusObjectPath &activeConnection);
+    // delays the replies to ActivateConnection, the active connection is created right away
+    void setActivationReplyDelay(int msec);
 
 private Q_SLOTS:
     void onConnectionAdded(const QDBusObjectPath &connection);
     void onConnectionRemoved(const QDBusObjectPath &connection);
-    void removeActiveConnection(const QDBusObjectPath &activeConnection);
     void updateConnectingState();
     void updateDeactivatingState();
 
@@ -107,6 +110,7 @@ private:
     QString m_activatedDevice;
     QString m_deactivatedDevice;
     int m_activeConnectionsCounter;
+    int m_activationReplyDelay;
     int m_deviceCounter;
     Settings *m_settings;
 };
@@ -93,6 +93,10 @@ void WirelessDevice::setActiveAccessPoint(const QString &activeAccessPoint)
 void WirelessDevice::setBitrate(uint bitrate)
 {
     m_bitrate = bitrate;
+
+    QVariantMap map;
+    map.insert(QLatin1String("Bitrate"), bitrate);
+    Q_EMIT PropertiesChanged(map);
 }
 
 void WirelessDevice::setHwAddress(const QString &hwAddress)
@@ -39,6 +39,105 @@ const QDBusArgument &operator>>(const QDBusArgument &argument, IpV6DBusRoute &ro
     return argument;
 }
 
+QDBusArgument &operator<<(QDBusArgument &argument, const NMAddressData &address)
+{
+    argument.beginMap(QMetaType::fromType<QString>(), QMetaType::fromType<QDBusVariant>());
+    argument.beginMapEntry();
+    argument << QStringLiteral("address") << QDBusVariant(address.address);
+    argument.endMapEntry();
+    if (address.hasPrefix) {
+        argument.beginMapEntry();
+        argument << QStringLiteral("prefix") << QDBusVariant(address.prefix);
+        argument.endMapEntry();
+    }
+    if (!address.gateway.isEmpty()) {
+        argument.beginMapEntry();
+        argument << QStringLiteral("gateway") << QDBusVariant(address.gateway);
+        argument.endMapEntry();
+    }
+    argument.endMap();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, NMAddressData &address)
+{
+    address = NMAddressData();
+    argument.beginMap();
+
+    while (!argument.atEnd()) {
+        QString key;
+        QDBusVariant value;
+        argument.beginMapEntry();
+        argument >> key >> value;
+        argument.endMapEntry();
+        if (key == QLatin1String("address")) {
+            address.address = value.variant().toString();
+        } else if (key == QLatin1String("prefix")) {
+            address.prefix = value.variant().toUInt();
+            address.hasPrefix = true;
+        } else if (key == QLatin1String("gateway")) {
+            address.gateway = value.variant().toString();
+        }
+    }
+
+    argument.endMap();
+    return argument;
+}
+
+QDBusArgument &operator<<(QDBusArgument &argument, const NMRouteData &route)
+{
+    argument.beginMap(QMetaType::fromType<QString>(), QMetaType::fromType<QDBusVariant>());
+    argument.beginMapEntry();
+    argument << QStringLiteral("dest") << QDBusVariant(route.dest);
+    argument.endMapEntry();
+    if (route.hasPrefix) {
+        argument.beginMapEntry();
+        argument << QStringLiteral("prefix") << QDBusVariant(route.prefix);
+        argument.endMapEntry();
+    }
+    if (!route.nextHop.isEmpty()) {
+        argument.beginMapEntry();
+        argument << QStringLiteral("next-hop") << QDBusVariant(route.nextHop);
+        argument.endMapEntry();
+    }
+    if (route.hasMetric) {
+        argument.beginMapEntry();
+        argument << QStringLiteral("metric") << QDBusVariant(route.metric);
+        argument.endMapEntry();
+    }
+    argument.endMap();
+    return argument;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &argument, NMRouteData &route)
+{
+    route = NMRouteData();
+    argument.beginMap();
+
+    while (!argument.atEnd()) {
+        QString key;
+        QDBusVariant value;
+        argument.beginMapEntry();
+        argument >> key >> value;
+        argument.endMapEntry();
+        // older daemons used "address" for the route destination
+        if (key == QLatin1String("dest") || key == QLatin1String("address")) {
+            route.dest = value.variant().toString();
+        } else if (key == QLatin1String("prefix")) {
+            route.prefix = value.variant().toUInt();
+            route.hasPrefix = true;
+        } else if (key == QLatin1String("next-hop")) {
+            route.nextHop = value.variant().toString();
+        } else if (key == QLatin1String("metric")) {
+            route.metric = value.variant().toUInt();
+            route.hasMetric = true;
+        }
+    }
+
+    argument.endMap();
+    return argument;
+}
+
 QDBusArgument &operator<<(QDBusArgument &argument, const NMStringMap &mydict)
 {
     argument.beginMap(QVariant::String, QVariant::String);
@@ -64,6 +64,37 @@ NETWORKMANAGERQT_EXPORT const QDBusArgument &operator>>(const QDBusArgument &arg
 typedef QList<QByteArray> IpV6DBusNameservers;
 Q_DECLARE_METATYPE(IpV6DBusNameservers)
 
+// Entries of the AddressData and RouteData properties (aa{sv}). The demarshallers
+// pick the known keys straight off the wire instead of building a QVariantMap per
+// entry, attributes they don't know about are skipped.
+struct NMAddressData {
+    QString address;
+    uint prefix = 0;
+    bool hasPrefix = false;
+    QString gateway;
+};
+Q_DECLARE_METATYPE(NMAddressData)
+typedef QList<NMAddressData> NMAddressDataList;
+Q_DECLARE_METATYPE(NMAddressDataList)
+
+NETWORKMANAGERQT_EXPORT QDBusArgument &operator<<(QDBusArgument &argument, const NMAddressData &address);
+NETWORKMANAGERQT_EXPORT const QDBusArgument &operator>>(const QDBusArgument &argument, NMAddressData &address);
+
+struct NMRouteData {
+    QString dest;
+    uint prefix = 0;
+    bool hasPrefix = false;
+    QString nextHop;
+    uint metric = 0;
+    bool hasMetric = false;
+};
+Q_DECLARE_METATYPE(NMRouteData)
+typedef QList<NMRouteData> NMRouteDataList;
+Q_DECLARE_METATYPE(NMRouteDataList)
+
+NETWORKMANAGERQT_EXPORT QDBusArgument &operator<<(QDBusArgument &argument, const NMRouteData &route);
+NETWORKMANAGERQT_EXPORT const QDBusArgument &operator>>(const QDBusArgument &argument, NMRouteData &route);
+
 typedef struct {
     uint state;
     uint reason;
@@ -34,6 +34,14 @@ NetworkManager::IpAddress::IpAddress(const NetworkManager::IpAddress &other)
     *this = other;
 }
 
+NetworkManager::IpAddress::IpAddress(const CompactIpAddress &address)
+    : d(new Private)
+{
+    setIp(address.address.toHostAddress());
+    setPrefixLength(address.prefixLength);
+    d->gateway = address.gateway.toHostAddress();
+}
+
 bool NetworkManager::IpAddress::isValid() const
 {
     return !ip().isNull();
@@ -49,6 +57,15 @@ QHostAddress NetworkManager::IpAddress::gateway() const
     return d->gateway;
 }
 
+NetworkManager::CompactIpAddress NetworkManager::IpAddress::toCompact() const
+{
+    CompactIpAddress address;
+    address.address = CompactIp::fromHostAddress(ip());
+    address.prefixLength = quint8(qMax(0, prefixLength()));
+    address.gateway = CompactIp::fromHostAddress(d->gateway);
+    return address;
+}
+
 NetworkManager::IpAddress &NetworkManager::IpAddress::operator=(const NetworkManager::IpAddress &other)
 {
     if (this == &other) {
@@ -8,6 +8,7 @@
 #ifndef NETWORKMANAGERQT_IPADDRESS_H
 #define NETWORKMANAGERQT_IPADDRESS_H
 
+#include "compactip.h"
 #include <networkmanagerqt/networkmanagerqt_export.h>
 
 #include <QNetworkAddressEntry>
@@ -30,6 +31,12 @@ public:
      */
     IpAddress(const IpAddress &other);
 
+    /**
+     * Constructs an IpAddress object from its compact counterpart @p address.
+     * @since 5.94.0
+     */
+    explicit IpAddress(const CompactIpAddress &address);
+
     /**
      * Destroys this IpAddress object.
      */
@@ -50,6 +57,12 @@ public:
      */
     QHostAddress gateway() const;
 
+    /**
+     * Returns the compact counterpart of this object.
+     * @since 5.94.0
+     */
+    CompactIpAddress toCompact() const;
+
     /**
      * Makes a copy of the IpAddress object @p other.
      */
@@ -12,6 +12,8 @@
 
 #include <arpa/inet.h>
 
+#include <QDBusMessage>
+
 #include "dbus/ip4configinterface.h"
 #include "dbus/ip6configinterface.h"
 
@@ -41,6 +43,24 @@ public:
 
 }
 
+namespace
+{
+// Reads an aa{sv} property straight into its typed form. Going through the
+// generated interface would first box every entry into a QVariantMap.
+template<typename T>
+T typedProperty(const QDBusAbstractInterface &iface, const QString &name)
+{
+    QDBusMessage message =
+        QDBusMessage::createMethodCall(iface.service(), iface.path(), NetworkManager::NetworkManagerPrivate::FDO_DBUS_PROPERTIES, QLatin1String("Get"));
+    message << iface.interface() << name;
+    const QDBusMessage reply = iface.connection().call(message);
+    if (reply.type() != QDBusMessage::ReplyMessage || reply.arguments().isEmpty()) {
+        return T();
+    }
+    return qdbus_cast<T>(qvariant_cast<QDBusVariant>(reply.arguments().constFirst()).variant());
+}
+}
+
 NetworkManager::IpConfig::IpConfig(const IpAddresses &addresses, const QList<QHostAddress> &nameservers, const QStringList &domains, const IpRoutes &routes)
     : d(new Private(addresses, nameservers, domains, routes))
 {
@@ -71,32 +91,31 @@ void NetworkManager::IpConfig::setIPv4Path(const QString &path)
     QList<NetworkManager::IpAddress> addressObjects;
     QList<NetworkManager::IpRoute> routeObjects;
     if (NetworkManager::checkVersion(1, 0, 0)) {
-        const NMVariantMapList addresses = iface.addressData();
-        for (const QVariantMap &addressList : addresses) {
-            if (addressList.contains(QLatin1String("address")) //
-                && addressList.contains(QLatin1String("prefix"))) {
+        const NMAddressDataList addresses = typedProperty<NMAddressDataList>(iface, QStringLiteral("AddressData"));
+        for (const NMAddressData &addressData : addresses) {
+            if (!addressData.address.isEmpty() && addressData.hasPrefix) {
                 NetworkManager::IpAddress address;
-                address.setIp(QHostAddress(addressList.value(QLatin1String("address")).toString()));
-                address.setPrefixLength(addressList.value(QLatin1String("prefix")).toUInt());
-                if (addressList.contains(QLatin1String("gateway"))) {
-                    address.setGateway(QHostAddress(addressList.value(QLatin1String("gateway")).toString()));
+                address.setIp(QHostAddress(addressData.address));
+                address.setPrefixLength(addressData.prefix);
+                if (!addressData.gateway.isEmpty()) {
+                    address.setGateway(QHostAddress(addressData.gateway));
                 }
                 addressObjects << address;
             }
         }
 
-        const NMVariantMapList routes = iface.routeData();
-        for (const QVariantMap &routeList : routes) {
-            if (routeList.contains(QLatin1String("address")) && routeList.contains(QLatin1String("prefix"))) {
+        const NMRouteDataList routes = typedProperty<NMRouteDataList>(iface, QStringLiteral("RouteData"));
+        for (const NMRouteData &routeData : routes) {
+            if (!routeData.dest.isEmpty() && routeData.hasPrefix) {
                 NetworkManager::IpRoute route;
-                route.setIp(QHostAddress(routeList.value(QLatin1String("address")).toString()));
-                route.setPrefixLength(routeList.value(QLatin1String("prefix")).toUInt());
-                if (routeList.contains(QLatin1String("next-hop"))) {
-                    route.setNextHop(QHostAddress(routeList.value(QLatin1String("next-hop")).toString()));
+                route.setIp(QHostAddress(routeData.dest));
+                route.setPrefixLength(routeData.prefix);
+                if (!routeData.nextHop.isEmpty()) {
+                    route.setNextHop(QHostAddress(routeData.nextHop));
                 }
 
-                if (routeList.contains(QLatin1String("metric"))) {
-                    route.setMetric(routeList.value(QLatin1String("metric")).toUInt());
+                if (routeData.hasMetric) {
+                    route.setMetric(routeData.metric);
                 }
                 routeObjects << route;
             }
@@ -159,32 +178,31 @@ void NetworkManager::IpConfig::setIPv6Path(const QString &path)
     QList<NetworkManager::IpAddress> addressObjects;
     QList<NetworkManager::IpRoute> routeObjects;
     if (NetworkManager::checkVersion(1, 0, 0)) {
-        const NMVariantMapList addresses = iface.addressData();
-        for (const QVariantMap &addressList : addresses) {
-            if (addressList.contains(QLatin1String("address")) //
-                && addressList.contains(QLatin1String("prefix"))) {
+        const NMAddressDataList addresses = typedProperty<NMAddressDataList>(iface, QStringLiteral("AddressData"));
+        for (const NMAddressData &addressData : addresses) {
+            if (!addressData.address.isEmpty() && addressData.hasPrefix) {
                 NetworkManager::IpAddress address;
-                address.setIp(QHostAddress(addressList.value(QLatin1String("address")).toString()));
-                address.setPrefixLength(addressList.value(QLatin1String("prefix")).toUInt());
-                if (addressList.contains(QLatin1String("gateway"))) {
-                    address.setGateway(QHostAddress(addressList.value(QLatin1String("gateway")).toString()));
+                address.setIp(QHostAddress(addressData.address));
+                address.setPrefixLength(addressData.prefix);
+                if (!addressData.gateway.isEmpty()) {
+                    address.setGateway(QHostAddress(addressData.gateway));
                 }
                 addressObjects << address;
             }
         }
 
-        const NMVariantMapList routes = iface.routeData();
-        for (const QVariantMap &routeList : routes) {
-            if (routeList.contains(QLatin1String("address")) && routeList.contains(QLatin1String("prefix"))) {
+        const NMRouteDataList routes = typedProperty<NMRouteDataList>(iface, QStringLiteral("RouteData"));
+        for (const NMRouteData &routeData : routes) {
+            if (!routeData.dest.isEmpty() && routeData.hasPrefix) {
                 NetworkManager::IpRoute route;
-                route.setIp(QHostAddress(routeList.value(QLatin1String("address")).toString()));
-                route.setPrefixLength(routeList.value(QLatin1String("prefix")).toUInt());
-                if (routeList.contains(QLatin1String("next-hop"))) {
-                    route.setNextHop(QHostAddress(routeList.value(QLatin1String("next-hop")).toString()));
+                route.setIp(QHostAddress(routeData.dest));
+                route.setPrefixLength(routeData.prefix);
+                if (!routeData.nextHop.isEmpty()) {
+                    route.setNextHop(QHostAddress(routeData.nextHop));
                 }
 
-                if (routeList.contains(QLatin1String("metric"))) {
-                    route.setMetric(routeList.value(QLatin1String("metric")).toUInt());
+                if (routeData.hasMetric) {
+                    route.setMetric(routeData.metric);
                 }
                 routeObjects << route;
             }
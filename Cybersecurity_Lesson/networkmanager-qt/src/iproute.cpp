@@ -39,6 +39,15 @@ NetworkManager::IpRoute::IpRoute(const NetworkManager::IpRoute &other)
     *this = other;
 }
 
+NetworkManager::IpRoute::IpRoute(const CompactIpRoute &route)
+    : d(new Private)
+{
+    setIp(route.destination.toHostAddress());
+    setPrefixLength(route.prefixLength);
+    d->nextHop = route.nextHop.toHostAddress();
+    d->metric = route.metric;
+}
+
 void NetworkManager::IpRoute::setNextHop(const QHostAddress &nextHop) const
 {
     d->nextHop = nextHop;
@@ -59,6 +68,16 @@ quint32 NetworkManager::IpRoute::metric() const
     return d->metric;
 }
 
+NetworkManager::CompactIpRoute NetworkManager::IpRoute::toCompact() const
+{
+    CompactIpRoute route;
+    route.destination = CompactIp::fromHostAddress(ip());
+    route.prefixLength = quint8(qMax(0, prefixLength()));
+    route.nextHop = CompactIp::fromHostAddress(d->nextHop);
+    route.metric = d->metric;
+    return route;
+}
+
 NetworkManager::IpRoute &NetworkManager::IpRoute::operator=(const NetworkManager::IpRoute &other)
 {
     if (this == &other) {
@@ -31,6 +31,12 @@ public:
      */
     IpRoute(const IpRoute &other);
 
+    /**
+     * Constructs an IpRoute object from its compact counterpart @p route.
+     * @since 5.94.0
+     */
+    explicit IpRoute(const CompactIpRoute &route);
+
     /**
      * Destroys this IpRoute object.
      */
@@ -62,6 +68,12 @@ public:
      */
     quint32 metric() const;
 
+    /**
+     * Returns the compact counterpart of this object.
+     * @since 5.94.0
+     */
+    CompactIpRoute toCompact() const;
+
     /**
      * Makes a copy of the IpRoute object @p other.
      */
@@ -0,0 +1,689 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "keyfile.h"
+
+#include "ipv4setting.h"
+#include "ipv6setting.h"
+#include "manager.h"
+#include "utils.h"
+
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QSet>
+#include <QThreadPool>
+
+#include <nm-setting-8021x.h>
+#include <nm-setting-connection.h>
+#include <nm-setting-wired.h>
+#include <nm-setting-wireless-security.h>
+#include <nm-setting-wireless.h>
+
+#include "nmdebug.h"
+
+namespace
+{
+// Short group names keyfiles use in place of the D-Bus setting names
+const char *const settingAliases[][2] = {
+    {NM_SETTING_WIRED_SETTING_NAME, "ethernet"},
+    {NM_SETTING_WIRELESS_SETTING_NAME, "wifi"},
+    {NM_SETTING_WIRELESS_SECURITY_SETTING_NAME, "wifi-security"},
+};
+
+QString settingNameFromAlias(const QString &alias)
+{
+    for (const auto &pair : settingAliases) {
+        if (alias == QLatin1String(pair[1])) {
+            return QLatin1String(pair[0]);
+        }
+    }
+    return alias;
+}
+
+QString aliasFromSettingName(const QString &name)
+{
+    for (const auto &pair : settingAliases) {
+        if (name == QLatin1String(pair[0])) {
+            return QLatin1String(pair[1]);
+        }
+    }
+    return name;
+}
+
+bool isStringListKey(const QString &settingName, const QString &key)
+{
+    static const QSet<QString> stringListKeys = {
+        QStringLiteral(NM_SETTING_CONNECTION_SETTING_NAME "." NM_SETTING_CONNECTION_PERMISSIONS),
+        QStringLiteral(NM_SETTING_CONNECTION_SETTING_NAME "." NM_SETTING_CONNECTION_SECONDARIES),
+        QStringLiteral("ipv4.dns-search"),
+        QStringLiteral("ipv4.dns-options"),
+        QStringLiteral("ipv6.dns-search"),
+        QStringLiteral("ipv6.dns-options"),
+        QStringLiteral(NM_SETTING_WIRED_SETTING_NAME "." NM_SETTING_WIRED_MAC_ADDRESS_BLACKLIST),
+        QStringLiteral(NM_SETTING_WIRED_SETTING_NAME "." NM_SETTING_WIRED_S390_SUBCHANNELS),
+        QStringLiteral(NM_SETTING_WIRELESS_SETTING_NAME "." NM_SETTING_WIRELESS_SEEN_BSSIDS),
+        QStringLiteral(NM_SETTING_WIRELESS_SETTING_NAME "." NM_SETTING_WIRELESS_MAC_ADDRESS_BLACKLIST),
+        QStringLiteral(NM_SETTING_WIRELESS_SECURITY_SETTING_NAME "." NM_SETTING_WIRELESS_SECURITY_PROTO),
+        QStringLiteral(NM_SETTING_WIRELESS_SECURITY_SETTING_NAME "." NM_SETTING_WIRELESS_SECURITY_PAIRWISE),
+        QStringLiteral(NM_SETTING_WIRELESS_SECURITY_SETTING_NAME "." NM_SETTING_WIRELESS_SECURITY_GROUP),
+        QStringLiteral(NM_SETTING_802_1X_SETTING_NAME "." NM_SETTING_802_1X_EAP),
+        QStringLiteral(NM_SETTING_802_1X_SETTING_NAME "." NM_SETTING_802_1X_ALTSUBJECT_MATCHES),
+        QStringLiteral(NM_SETTING_802_1X_SETTING_NAME "." NM_SETTING_802_1X_PHASE2_ALTSUBJECT_MATCHES),
+        QStringLiteral("match.interface-name"),
+        QStringLiteral("match.driver"),
+    };
+    return stringListKeys.contains(settingName + QLatin1Char('.') + key);
+}
+
+// Enum properties keyfiles store by name instead of by number
+struct EnumNick {
+    const char *key;
+    const char *nick;
+    int value;
+};
+
+const EnumNick enumNicks[] = {
+    {NMQT_SETTING_IP6_CONFIG_SETTING_NAME "." NMQT_SETTING_IP6_CONFIG_ADDRESS_GEN_MODE, "eui64", NetworkManager::Ipv6Setting::Eui64},
+    {NMQT_SETTING_IP6_CONFIG_SETTING_NAME "." NMQT_SETTING_IP6_CONFIG_ADDRESS_GEN_MODE, "stable-privacy", NetworkManager::Ipv6Setting::StablePrivacy},
+};
+
+QVariant enumValue(const QString &settingName, const QString &key, const QString &value)
+{
+    const QString fullKey = settingName + QLatin1Char('.') + key;
+    for (const EnumNick &nick : enumNicks) {
+        if (fullKey == QLatin1String(nick.key) && value == QLatin1String(nick.nick)) {
+            return nick.value;
+        }
+    }
+    return value;
+}
+
+// Settings constructors consult the daemon version, which creates the manager
+// and its D-Bus connection on first use. Do that on the calling thread rather
+// than on a pool thread that is gone once the pool is done.
+void initManager()
+{
+    NetworkManager::version();
+}
+
+bool isMacAddressKey(const QString &key)
+{
+    return key == QLatin1String("mac-address") || key == QLatin1String("cloned-mac-address") || key == QLatin1String("bssid");
+}
+
+bool isCertificateKey(const QString &key)
+{
+    return key == QLatin1String(NM_SETTING_802_1X_CA_CERT) || key == QLatin1String(NM_SETTING_802_1X_CLIENT_CERT)
+        || key == QLatin1String(NM_SETTING_802_1X_PRIVATE_KEY) || key == QLatin1String(NM_SETTING_802_1X_PHASE2_CA_CERT)
+        || key == QLatin1String(NM_SETTING_802_1X_PHASE2_CLIENT_CERT) || key == QLatin1String(NM_SETTING_802_1X_PHASE2_PRIVATE_KEY);
+}
+
+// GKeyFile escape sequences, list items are separated by unescaped ';'
+QStringList unescape(QStringView value, bool isList)
+{
+    QStringList items;
+    QString current;
+    current.reserve(value.size());
+    for (qsizetype i = 0; i < value.size(); ++i) {
+        const QChar c = value.at(i);
+        if (c == QLatin1Char('\\') && i + 1 < value.size()) {
+            const QChar next = value.at(++i);
+            switch (next.unicode()) {
+            case 's':
+                current += QLatin1Char(' ');
+                break;
+            case 'n':
+                current += QLatin1Char('\n');
+                break;
+            case 't':
+                current += QLatin1Char('\t');
+                break;
+            case 'r':
+                current += QLatin1Char('\r');
+                break;
+            default:
+                current += next;
+                break;
+            }
+        } else if (isList && c == QLatin1Char(';')) {
+            items << current;
+            current.clear();
+        } else {
+            current += c;
+        }
+    }
+    if (!isList || !current.isEmpty()) {
+        items << current;
+    }
+    return items;
+}
+
+QString escape(const QString &value, bool isListItem)
+{
+    QString escaped;
+    escaped.reserve(value.size());
+    for (qsizetype i = 0; i < value.size(); ++i) {
+        const QChar c = value.at(i);
+        if (c == QLatin1Char('\\')) {
+            escaped += QLatin1String("\\\\");
+        } else if (c == QLatin1Char('\n')) {
+            escaped += QLatin1String("\\n");
+        } else if (c == QLatin1Char('\t')) {
+            escaped += QLatin1String("\\t");
+        } else if (c == QLatin1Char('\r')) {
+            escaped += QLatin1String("\\r");
+        } else if (c == QLatin1Char(' ') && i == 0) {
+            escaped += QLatin1String("\\s");
+        } else if (c == QLatin1Char(';') && isListItem) {
+            escaped += QLatin1String("\\;");
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// Binary values are written as a list of decimal bytes, "1;2;3;"
+QByteArray bytesFromList(const QString &value, bool *ok)
+{
+    QByteArray bytes;
+    *ok = value.contains(QLatin1Char(';'));
+    const auto items = QStringView(value).split(QLatin1Char(';'), Qt::SkipEmptyParts);
+    for (const QStringView &item : items) {
+        const uint byte = item.toUInt(ok);
+        if (!*ok || byte > 255) {
+            *ok = false;
+            return QByteArray();
+        }
+        bytes.append(char(byte));
+    }
+    return bytes;
+}
+
+QString bytesToList(const QByteArray &bytes)
+{
+    QString list;
+    for (const char byte : bytes) {
+        list += QString::number(uchar(byte)) + QLatin1Char(';');
+    }
+    return list;
+}
+
+// Certificates are "data:;base64,..." blobs or paths, on D-Bus paths and
+// PKCS#11 URIs are NUL terminated
+QByteArray certificateFromKeyFile(const QString &value)
+{
+    if (value.startsWith(QLatin1String("data:;base64,"))) {
+        return QByteArray::fromBase64(QStringView(value).mid(13).toLatin1());
+    }
+    if (value.startsWith(QLatin1String("pkcs11:")) || value.startsWith(QLatin1String("file://"))) {
+        return value.toUtf8() + '\0';
+    }
+    return "file://" + value.toUtf8() + '\0';
+}
+
+QString certificateToKeyFile(const QByteArray &value)
+{
+    if (value.startsWith("file://")) {
+        return QString::fromUtf8(value.mid(7).chopped(value.endsWith('\0') ? 1 : 0));
+    }
+    if (value.startsWith("pkcs11:")) {
+        return QString::fromUtf8(value.chopped(value.endsWith('\0') ? 1 : 0));
+    }
+    return QLatin1String("data:;base64,") + QString::fromLatin1(value.toBase64());
+}
+
+// Typed values of the ipv4/ipv6 groups, keyfiles use their own notation for these
+struct IpConfig {
+    QMap<int, NetworkManager::IpAddress> addresses;
+    QMap<int, NetworkManager::IpRoute> routes;
+    QList<QHostAddress> dns;
+    int addressPrefix = 24;
+    int hostPrefix = 32;
+};
+
+// Index of "address1", "addresses2", "route" etc, -1 if @p key isn't one of them
+int keyIndex(const QString &key, QLatin1String prefix)
+{
+    if (!key.startsWith(prefix)) {
+        return -1;
+    }
+    QStringView rest = QStringView(key).mid(prefix.size());
+    if (rest.startsWith(QLatin1Char('s'))) {
+        rest = rest.mid(1);
+    }
+    if (rest.isEmpty()) {
+        return 0;
+    }
+    bool ok;
+    const int index = rest.toInt(&ok);
+    return ok && index >= 0 ? index : -1;
+}
+
+// "address/prefix,gateway" and "dest/prefix,next-hop,metric", older files separate with ';'
+QStringList ipFields(const QString &value)
+{
+    QString fields = value;
+    fields.replace(QLatin1Char(';'), QLatin1Char(','));
+    return fields.split(QLatin1Char(','), Qt::SkipEmptyParts);
+}
+
+bool parseIpWithPrefix(const QString &field, int defaultPrefix, QHostAddress &ip, int &prefix)
+{
+    const int slash = field.indexOf(QLatin1Char('/'));
+    ip = QHostAddress(field.left(slash).trimmed());
+    bool ok = true;
+    prefix = slash < 0 ? defaultPrefix : QStringView(field).mid(slash + 1).trimmed().toInt(&ok);
+    return ok && !ip.isNull();
+}
+
+bool isUnspecified(const QHostAddress &address)
+{
+    return address.isNull() || address == QHostAddress(QHostAddress::AnyIPv4) || address == QHostAddress(QHostAddress::AnyIPv6);
+}
+
+void insertIpValue(const QString &key, const QString &value, IpConfig &config)
+{
+    int index;
+    if ((index = keyIndex(key, QLatin1String("address"))) >= 0) {
+        const QStringList fields = ipFields(value);
+        QHostAddress ip;
+        int prefix;
+        if (fields.isEmpty() || !parseIpWithPrefix(fields.at(0), config.addressPrefix, ip, prefix)) {
+            qCWarning(NMQT) << "Ignoring invalid address" << key << value;
+            return;
+        }
+        NetworkManager::IpAddress address;
+        address.setIp(ip);
+        address.setPrefixLength(prefix);
+        if (fields.size() > 1) {
+            address.setGateway(QHostAddress(fields.at(1).trimmed()));
+        }
+        config.addresses.insert(index, address);
+    } else if ((index = keyIndex(key, QLatin1String("route"))) >= 0) {
+        const QStringList fields = ipFields(value);
+        QHostAddress ip;
+        int prefix;
+        if (fields.isEmpty() || !parseIpWithPrefix(fields.at(0), config.hostPrefix, ip, prefix)) {
+            qCWarning(NMQT) << "Ignoring invalid route" << key << value;
+            return;
+        }
+        NetworkManager::IpRoute route;
+        route.setIp(ip);
+        route.setPrefixLength(prefix);
+        if (fields.size() > 1) {
+            route.setNextHop(QHostAddress(fields.at(1).trimmed()));
+        }
+        if (fields.size() > 2) {
+            route.setMetric(fields.at(2).trimmed().toUInt());
+        }
+        config.routes.insert(index, route);
+    } else if (key == QLatin1String("dns")) {
+        const QStringList servers = unescape(value, true);
+        for (const QString &server : servers) {
+            const QHostAddress address(server.trimmed());
+            if (!address.isNull()) {
+                config.dns << address;
+            }
+        }
+    }
+}
+
+void insertValue(const QString &settingName, const QString &key, QStringView rawValue, QVariantMap &setting, IpConfig *ipConfig)
+{
+    if (ipConfig) {
+        // addressN/routeN/dns are applied on the typed setting, route attributes aren't modelled
+        if (keyIndex(key, QLatin1String("address")) >= 0 || keyIndex(key, QLatin1String("route")) >= 0 || key == QLatin1String("dns")) {
+            insertIpValue(key, key == QLatin1String("dns") ? rawValue.toString() : unescape(rawValue, false).constFirst(), *ipConfig);
+            return;
+        }
+        if (key.endsWith(QLatin1String("_options"))) {
+            return;
+        }
+    }
+
+    if (isStringListKey(settingName, key)) {
+        setting.insert(key, unescape(rawValue, true));
+        return;
+    }
+
+    const QString value = unescape(rawValue, false).constFirst();
+    bool ok = false;
+    if (isMacAddressKey(key) && value.count(QLatin1Char(':')) == 5) {
+        setting.insert(key, NetworkManager::macAddressFromString(value));
+    } else if (key == QLatin1String(NM_SETTING_WIRELESS_SSID) || key == QLatin1String(NM_SETTING_802_1X_PASSWORD_RAW)) {
+        const QByteArray bytes = bytesFromList(value, &ok);
+        setting.insert(key, ok ? bytes : value.toUtf8());
+    } else if (isCertificateKey(key)) {
+        setting.insert(key, certificateFromKeyFile(value));
+    } else if (settingName == QLatin1String(NM_SETTING_CONNECTION_SETTING_NAME) && key == QLatin1String(NM_SETTING_CONNECTION_TYPE)) {
+        setting.insert(key, settingNameFromAlias(value));
+    } else {
+        // plain values stay strings, fromMap() converts them
+        setting.insert(key, enumValue(settingName, key, value));
+    }
+}
+
+template<typename T>
+void applyIpConfig(const QSharedPointer<T> &setting, const IpConfig &config)
+{
+    if (!setting) {
+        return;
+    }
+    if (!config.addresses.isEmpty()) {
+        setting->setAddresses(config.addresses.values());
+    }
+    if (!config.routes.isEmpty()) {
+        setting->setRoutes(config.routes.values());
+    }
+    if (!config.dns.isEmpty()) {
+        setting->setDns(config.dns);
+    }
+}
+
+template<typename T>
+void writeIpConfig(QString &out, const QSharedPointer<T> &setting)
+{
+    if (!setting) {
+        return;
+    }
+    int index = 1;
+    const QList<NetworkManager::IpAddress> addresses = setting->addresses();
+    for (const NetworkManager::IpAddress &address : addresses) {
+        out += QLatin1String("address") + QString::number(index++) + QLatin1Char('=') + address.ip().toString() + QLatin1Char('/')
+            + QString::number(address.prefixLength());
+        if (!isUnspecified(address.gateway())) {
+            out += QLatin1Char(',') + address.gateway().toString();
+        }
+        out += QLatin1Char('\n');
+    }
+    index = 1;
+    const QList<NetworkManager::IpRoute> routes = setting->routes();
+    for (const NetworkManager::IpRoute &route : routes) {
+        out += QLatin1String("route") + QString::number(index++) + QLatin1Char('=') + route.ip().toString() + QLatin1Char('/')
+            + QString::number(route.prefixLength());
+        if (!isUnspecified(route.nextHop()) || route.metric()) {
+            QHostAddress nextHop = route.nextHop();
+            if (nextHop.isNull()) {
+                nextHop = route.ip().protocol() == QAbstractSocket::IPv4Protocol ? QHostAddress(QHostAddress::AnyIPv4) : QHostAddress(QHostAddress::AnyIPv6);
+            }
+            out += QLatin1Char(',') + nextHop.toString();
+        }
+        if (route.metric()) {
+            out += QLatin1Char(',') + QString::number(route.metric());
+        }
+        out += QLatin1Char('\n');
+    }
+    const QList<QHostAddress> dns = setting->dns();
+    if (!dns.isEmpty()) {
+        out += QLatin1String("dns=");
+        for (const QHostAddress &server : dns) {
+            out += server.toString() + QLatin1Char(';');
+        }
+        out += QLatin1Char('\n');
+    }
+}
+
+bool valueToKeyFile(const QString &settingName, const QString &key, const QVariant &value, QString &out)
+{
+    switch (value.metaType().id()) {
+    case QMetaType::Bool:
+        out = value.toBool() ? QStringLiteral("true") : QStringLiteral("false");
+        return true;
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+    case QMetaType::Double:
+        out = value.toString();
+        return true;
+    case QMetaType::QString:
+        if (settingName == QLatin1String(NM_SETTING_CONNECTION_SETTING_NAME) && key == QLatin1String(NM_SETTING_CONNECTION_TYPE)) {
+            out = aliasFromSettingName(value.toString());
+        } else {
+            out = escape(value.toString(), false);
+        }
+        return true;
+    case QMetaType::QStringList: {
+        out.clear();
+        const QStringList items = value.toStringList();
+        for (const QString &item : items) {
+            out += escape(item, true) + QLatin1Char(';');
+        }
+        return true;
+    }
+    case QMetaType::QByteArray: {
+        const QByteArray bytes = value.toByteArray();
+        if (isMacAddressKey(key) && bytes.size() == 6) {
+            out = NetworkManager::macAddressAsString(bytes);
+        } else if (isCertificateKey(key)) {
+            out = certificateToKeyFile(bytes);
+        } else if (key == QLatin1String(NM_SETTING_WIRELESS_SSID) && !bytes.contains(';') && QString::fromUtf8(bytes).toUtf8() == bytes) {
+            out = escape(QString::fromUtf8(bytes), false);
+        } else {
+            out = bytesToList(bytes);
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+void writeGroup(QString &out, const QString &settingName, const QVariantMap &values, const NetworkManager::ConnectionSettings::Ptr &settings)
+{
+    const bool isIpConfig = settingName == QLatin1String(NMQT_SETTING_IP4_CONFIG_SETTING_NAME) || settingName == QLatin1String(NMQT_SETTING_IP6_CONFIG_SETTING_NAME);
+
+    out += QLatin1Char('[') + aliasFromSettingName(settingName) + QLatin1String("]\n");
+    for (auto it = values.constBegin(); it != values.constEnd(); ++it) {
+        if (isIpConfig
+            && (it.key() == QLatin1String("addresses") || it.key() == QLatin1String("routes") || it.key() == QLatin1String("dns")
+                || it.key() == QLatin1String("address-data") || it.key() == QLatin1String("route-data"))) {
+            continue;
+        }
+        QString value;
+        if (!valueToKeyFile(settingName, it.key(), it.value(), value)) {
+            qCWarning(NMQT) << "Can't write" << settingName << it.key() << "of type" << it.value().metaType().name() << "to a keyfile";
+            continue;
+        }
+        out += it.key() + QLatin1Char('=') + value + QLatin1Char('\n');
+    }
+
+    if (settingName == QLatin1String(NMQT_SETTING_IP4_CONFIG_SETTING_NAME)) {
+        writeIpConfig(out, settings->setting(NetworkManager::Setting::Ipv4).staticCast<NetworkManager::Ipv4Setting>());
+    } else if (settingName == QLatin1String(NMQT_SETTING_IP6_CONFIG_SETTING_NAME)) {
+        writeIpConfig(out, settings->setting(NetworkManager::Setting::Ipv6).staticCast<NetworkManager::Ipv6Setting>());
+    }
+    out += QLatin1Char('\n');
+}
+}
+
+NetworkManager::ConnectionSettings::Ptr NetworkManager::keyFileToSettings(const QByteArray &data)
+{
+    NMVariantMapMap map;
+    IpConfig ipv4Config;
+    IpConfig ipv6Config;
+    ipv6Config.addressPrefix = 64;
+    ipv6Config.hostPrefix = 128;
+
+    QString settingName;
+    QVariantMap *setting = nullptr;
+    IpConfig *ipConfig = nullptr;
+
+    qsizetype start = 0;
+    while (start < data.size()) {
+        qsizetype end = data.indexOf('\n', start);
+        if (end < 0) {
+            end = data.size();
+        }
+        const QString line = QString::fromUtf8(data.constData() + start, end - start);
+        start = end + 1;
+
+        // Like GKeyFile only leading whitespace of the line is dropped, trailing
+        // whitespace belongs to the value
+        QStringView view(line);
+        if (view.endsWith(QLatin1Char('\r'))) {
+            view.chop(1);
+        }
+        while (!view.isEmpty() && view.front().isSpace()) {
+            view = view.mid(1);
+        }
+        if (view.isEmpty() || view.startsWith(QLatin1Char('#'))) {
+            continue;
+        }
+
+        if (view.startsWith(QLatin1Char('['))) {
+            const QStringView group = view.trimmed();
+            if (!group.endsWith(QLatin1Char(']'))) {
+                qCWarning(NMQT) << "Invalid keyfile group" << group;
+                return ConnectionSettings::Ptr();
+            }
+            settingName = settingNameFromAlias(group.mid(1, group.size() - 2).toString());
+            setting = &map[settingName];
+            if (settingName == QLatin1String(NMQT_SETTING_IP4_CONFIG_SETTING_NAME)) {
+                ipConfig = &ipv4Config;
+            } else if (settingName == QLatin1String(NMQT_SETTING_IP6_CONFIG_SETTING_NAME)) {
+                ipConfig = &ipv6Config;
+            } else {
+                ipConfig = nullptr;
+            }
+            continue;
+        }
+
+        const qsizetype equals = view.indexOf(QLatin1Char('='));
+        if (equals <= 0 || !setting) {
+            qCWarning(NMQT) << "Invalid keyfile line" << view;
+            return ConnectionSettings::Ptr();
+        }
+        const QString key = view.left(equals).trimmed().toString();
+        if (key.contains(QLatin1Char('['))) {
+            // localized values aren't used by NetworkManager
+            continue;
+        }
+        QStringView value = view.mid(equals + 1);
+        while (!value.isEmpty() && value.front().isSpace()) {
+            value = value.mid(1);
+        }
+        insertValue(settingName, key, value, *setting, ipConfig);
+    }
+
+    if (!map.contains(QLatin1String(NM_SETTING_CONNECTION_SETTING_NAME))) {
+        return ConnectionSettings::Ptr();
+    }
+
+    ConnectionSettings::Ptr settings(new ConnectionSettings());
+    settings->fromMap(map);
+    if (map.contains(QLatin1String(NMQT_SETTING_IP4_CONFIG_SETTING_NAME))) {
+        applyIpConfig(settings->setting(Setting::Ipv4).staticCast<Ipv4Setting>(), ipv4Config);
+    }
+    if (map.contains(QLatin1String(NMQT_SETTING_IP6_CONFIG_SETTING_NAME))) {
+        applyIpConfig(settings->setting(Setting::Ipv6).staticCast<Ipv6Setting>(), ipv6Config);
+    }
+    return settings;
+}
+
+NetworkManager::ConnectionSettings::Ptr NetworkManager::readKeyFile(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCWarning(NMQT) << "Failed to open" << fileName << file.errorString();
+        return ConnectionSettings::Ptr();
+    }
+
+    const ConnectionSettings::Ptr settings = keyFileToSettings(file.readAll());
+    if (!settings) {
+        qCWarning(NMQT) << "Failed to parse" << fileName;
+    }
+    return settings;
+}
+
+QMap<QString, NetworkManager::ConnectionSettings::Ptr> NetworkManager::readKeyFiles(const QString &directory)
+{
+    const QFileInfoList files = QDir(directory).entryInfoList({QStringLiteral("*.nmconnection")}, QDir::Files, QDir::Name);
+
+    // Every task writes only its own slot, the list must not detach while they run
+    QList<ConnectionSettings::Ptr> parsed(files.size());
+    ConnectionSettings::Ptr *results = parsed.data();
+    initManager();
+    QThreadPool pool;
+    for (qsizetype i = 0; i < files.size(); ++i) {
+        const QString fileName = files.at(i).absoluteFilePath();
+        pool.start([results, i, fileName] {
+            results[i] = readKeyFile(fileName);
+        });
+    }
+    pool.waitForDone();
+
+    QMap<QString, ConnectionSettings::Ptr> result;
+    for (qsizetype i = 0; i < files.size(); ++i) {
+        result.insert(files.at(i).absoluteFilePath(), parsed.at(i));
+    }
+    return result;
+}
+
+QByteArray NetworkManager::settingsToKeyFile(const ConnectionSettings::Ptr &settings)
+{
+    if (!settings) {
+        return QByteArray();
+    }
+
+    const NMVariantMapMap map = settings->toMap();
+    QString out;
+    writeGroup(out, QLatin1String(NM_SETTING_CONNECTION_SETTING_NAME), map.value(QLatin1String(NM_SETTING_CONNECTION_SETTING_NAME)), settings);
+    for (auto it = map.constBegin(); it != map.constEnd(); ++it) {
+        if (it.key() != QLatin1String(NM_SETTING_CONNECTION_SETTING_NAME)) {
+            writeGroup(out, it.key(), it.value(), settings);
+        }
+    }
+    return out.toUtf8();
+}
+
+bool NetworkManager::writeKeyFile(const ConnectionSettings::Ptr &settings, const QString &fileName)
+{
+    if (!settings) {
+        return false;
+    }
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(NMQT) << "Failed to open" << fileName << file.errorString();
+        return false;
+    }
+    // NetworkManager ignores keyfiles readable by others
+    file.setPermissions(QFileDevice::ReadOwner | QFileDevice::WriteOwner);
+    file.write(settingsToKeyFile(settings));
+    if (!file.commit()) {
+        qCWarning(NMQT) << "Failed to write" << fileName << file.errorString();
+        return false;
+    }
+    return true;
+}
+
+QStringList NetworkManager::writeKeyFiles(const ConnectionSettings::List &settings, const QString &directory)
+{
+    const QDir dir(directory);
+    QList<bool> written(settings.size(), false);
+    bool *results = written.data();
+    initManager();
+    QThreadPool pool;
+    for (qsizetype i = 0; i < settings.size(); ++i) {
+        const ConnectionSettings::Ptr connection = settings.at(i);
+        const QString fileName = dir.absoluteFilePath(connection->uuid() + QLatin1String(".nmconnection"));
+        pool.start([results, i, connection, fileName] {
+            results[i] = writeKeyFile(connection, fileName);
+        });
+    }
+    pool.waitForDone();
+
+    QStringList fileNames;
+    for (qsizetype i = 0; i < settings.size(); ++i) {
+        if (written.at(i)) {
+            fileNames << dir.absoluteFilePath(settings.at(i)->uuid() + QLatin1String(".nmconnection"));
+        }
+    }
+    return fileNames;
+}
@@ -0,0 +1,71 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_KEYFILE_H
+#define NETWORKMANAGERQT_KEYFILE_H
+
+#include "connectionsettings.h"
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include <QMap>
+#include <QStringList>
+
+/**
+ * Reading and writing of NetworkManager keyfiles (.nmconnection) without
+ * going through the daemon, e.g. to validate or transform a set of profiles
+ * offline before handing them to NetworkManager with loadConnections().
+ *
+ * Only the settings modelled by ConnectionSettings are mapped, groups of
+ * other settings are skipped when reading.
+ */
+namespace NetworkManager
+{
+/**
+ * Parses the contents of a keyfile.
+ * @return the connection settings, or a null pointer if @p data has no [connection] group
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT ConnectionSettings::Ptr keyFileToSettings(const QByteArray &data);
+
+/**
+ * Reads and parses the keyfile @p fileName.
+ * @return the connection settings, or a null pointer if the file can't be read or parsed
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT ConnectionSettings::Ptr readKeyFile(const QString &fileName);
+
+/**
+ * Reads every *.nmconnection file in @p directory, the files are parsed in parallel.
+ * @return the parsed settings keyed by absolute file name, files that failed
+ * to parse map to a null pointer
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT QMap<QString, ConnectionSettings::Ptr> readKeyFiles(const QString &directory);
+
+/**
+ * Serializes @p settings into the keyfile format.
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT QByteArray settingsToKeyFile(const ConnectionSettings::Ptr &settings);
+
+/**
+ * Writes @p settings to @p fileName, readable by the owner only as NetworkManager requires.
+ * @return true on success
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT bool writeKeyFile(const ConnectionSettings::Ptr &settings, const QString &fileName);
+
+/**
+ * Writes each of @p settings to "<uuid>.nmconnection" in @p directory, the files
+ * are written in parallel. The result can be passed to loadConnections() to make
+ * NetworkManager pick all of them up in a single call.
+ * @return the absolute names of the files which were written
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT QStringList writeKeyFiles(const ConnectionSettings::List &settings, const QString &directory);
+}
+
+#endif // NETWORKMANAGERQT_KEYFILE_H
@@ -26,6 +26,8 @@
 
 #include "nmdebug.h"
 
+#include <chrono>
+
 #define DBUS_OBJECT_MANAGER "org.freedesktop.DBus.ObjectManager"
 #define DBUS_PROPERTIES "org.freedesktop.DBus.Properties"
 
@@ -64,6 +66,8 @@ NetworkManager::NetworkManagerPrivate::NetworkManagerPrivate()
     , m_isWwanHardwareEnabled(false)
     , m_globalDnsConfiguration(NetworkManager::DnsConfiguration())
     , m_supportedInterfaceTypes(NetworkManager::Device::UnknownType)
+    , m_journalCapacity(4096)
+    , m_journalSequence(0)
 {
     connect(&iface, &OrgFreedesktopNetworkManagerInterface::DeviceAdded, this, &NetworkManagerPrivate::onDeviceAdded);
     connect(&iface, &OrgFreedesktopNetworkManagerInterface::DeviceRemoved, this, &NetworkManagerPrivate::onDeviceRemoved);
@@ -120,6 +124,10 @@ void NetworkManager::NetworkManagerPrivate::init()
     qDBusRegisterMetaType<NMVariantMapMap>();
     qDBusRegisterMetaType<NMVariantMapList>();
     qDBusRegisterMetaType<NMStringMap>();
+    qDBusRegisterMetaType<NMAddressData>();
+    qDBusRegisterMetaType<NMAddressDataList>();
+    qDBusRegisterMetaType<NMRouteData>();
+    qDBusRegisterMetaType<NMRouteDataList>();
 
     m_version = iface.version();
     parseVersion(m_version);
@@ -148,6 +156,7 @@ void NetworkManager::NetworkManagerPrivate::init()
         qCDebug(NMQT) << "Device list";
         for (const QDBusObjectPath &op : devices) {
             networkInterfaceMap.insert(op.path(), Device::Ptr());
+            recordEvent(JournalEvent::DeviceAdded, op.path(), op.path());
             Q_EMIT deviceAdded(op.path());
             qCDebug(NMQT) << "  " << op.path();
         }
@@ -599,11 +608,64 @@ void NetworkManager::NetworkManagerPrivate::setGlobalDnsConfiguration(const Netw
     iface.setGlobalDnsConfiguration(m_globalDnsConfiguration.toMap());
 }
 
+void NetworkManager::NetworkManagerPrivate::recordEvent(JournalEvent::Type type, const QString &uni, const QString &device)
+{
+    if (m_journalCapacity <= 0) {
+        ++m_journalSequence;
+        return;
+    }
+
+    while (m_journal.size() >= m_journalCapacity) {
+        m_journal.removeFirst();
+    }
+    m_journal.append({++m_journalSequence, type, uni, device});
+}
+
+bool NetworkManager::NetworkManagerPrivate::eventsSince(quint64 sequence, QList<JournalEvent> &events) const
+{
+    events.clear();
+    if (sequence > m_journalSequence) {
+        // Not a sequence number handed out by this journal
+        return false;
+    }
+    if (sequence == m_journalSequence) {
+        return true;
+    }
+    if (m_journal.isEmpty() || m_journal.constFirst().sequence > sequence + 1) {
+        return false;
+    }
+
+    // Sequence numbers are contiguous, so the first wanted entry can be indexed directly
+    events = m_journal.mid(static_cast<qsizetype>(sequence + 1 - m_journal.constFirst().sequence));
+    return true;
+}
+
+void NetworkManager::NetworkManagerPrivate::setEventJournalCapacity(int capacity)
+{
+    m_journalCapacity = qMax(0, capacity);
+    if (m_journal.size() > m_journalCapacity) {
+        m_journal.remove(0, m_journal.size() - m_journalCapacity);
+    }
+}
+
+void NetworkManager::NetworkManagerPrivate::journal(JournalEvent::Type type, const QString &uni, const QString &device)
+{
+    if (!globalNetworkManager.isDestroyed()) {
+        globalNetworkManager->recordEvent(type, uni, device);
+    }
+}
+
+qint64 NetworkManager::NetworkManagerPrivate::monotonicTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void NetworkManager::NetworkManagerPrivate::onDeviceAdded(const QDBusObjectPath &objpath)
 {
     // qCDebug(NMQT);
     if (!networkInterfaceMap.contains(objpath.path())) {
         networkInterfaceMap.insert(objpath.path(), Device::Ptr());
+        recordEvent(JournalEvent::DeviceAdded, objpath.path(), objpath.path());
         Q_EMIT deviceAdded(objpath.path());
     }
 }
@@ -612,6 +674,7 @@ void NetworkManager::NetworkManagerPrivate::onDeviceRemoved(const QDBusObjectPat
 {
     // qCDebug(NMQT);
     networkInterfaceMap.remove(objpath.path());
+    recordEvent(JournalEvent::DeviceRemoved, objpath.path(), objpath.path());
     Q_EMIT deviceRemoved(objpath.path());
 }
 
@@ -807,6 +870,7 @@ void NetworkManager::NetworkManagerPrivate::daemonUnregistered()
     stateChanged(NM_STATE_UNKNOWN);
     QMap<QString, Device::Ptr>::const_iterator i = networkInterfaceMap.constBegin();
     while (i != networkInterfaceMap.constEnd()) {
+        recordEvent(JournalEvent::DeviceRemoved, i.key(), i.key());
         Q_EMIT deviceRemoved(i.key());
         ++i;
     }
@@ -1064,3 +1128,23 @@ NetworkManager::Notifier *NetworkManager::notifier()
 {
     return globalNetworkManager;
 }
+
+quint64 NetworkManager::eventJournalSequence()
+{
+    return globalNetworkManager->m_journalSequence;
+}
+
+bool NetworkManager::eventsSince(quint64 sequence, QList<JournalEvent> &events)
+{
+    return globalNetworkManager->eventsSince(sequence, events);
+}
+
+int NetworkManager::eventJournalCapacity()
+{
+    return globalNetworkManager->m_journalCapacity;
+}
+
+void NetworkManager::setEventJournalCapacity(int capacity)
+{
+    globalNetworkManager->setEventJournalCapacity(capacity);
+}
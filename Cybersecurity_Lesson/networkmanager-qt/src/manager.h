@@ -104,6 +104,34 @@ enum Connectivity {
     Full = 4, /**< The host is connected to a network, and appears to be able to reach the full Internet. */
 };
 
+/**
+ * An entry of the event journal kept by the manager.
+ *
+ * Every device, access point, network and connection change observed by the
+ * library is recorded with a monotonically increasing sequence number, so
+ * consumers which missed the corresponding signals can catch up with
+ * eventsSince() instead of enumerating everything again.
+ */
+struct JournalEvent {
+    enum Type {
+        DeviceAdded, /**< @p uni is the path of the new device */
+        DeviceRemoved, /**< @p uni is the path of the removed device */
+        DeviceStateChanged, /**< @p uni is the path of the device */
+        AccessPointAppeared, /**< @p uni is the access point path, @p device the wireless device */
+        AccessPointDisappeared, /**< @p uni is the access point path, @p device the wireless device */
+        NetworkAppeared, /**< @p uni is the SSID of the network, @p device the wireless device */
+        NetworkDisappeared, /**< @p uni is the SSID of the network, @p device the wireless device */
+        ConnectionAdded, /**< @p uni is the path of the new connection */
+        ConnectionRemoved, /**< @p uni is the path of the removed connection */
+        ConnectionUpdated, /**< @p uni is the path of the updated connection */
+    };
+
+    quint64 sequence;
+    Type type;
+    QString uni;
+    QString device;
+};
+
 class NETWORKMANAGERQT_EXPORT Notifier : public QObject
 {
     Q_OBJECT
@@ -485,6 +513,33 @@ NETWORKMANAGERQT_EXPORT void setLogging(LogLevel, LogDomains);
 NETWORKMANAGERQT_EXPORT NMStringMap permissions();
 NETWORKMANAGERQT_EXPORT Notifier *notifier();
 
+/**
+ * @return the sequence number of the newest event journal entry, or 0 if
+ * nothing has been recorded yet. Remember it after enumerating devices and
+ * networks and pass it to eventsSince() later on.
+ */
+NETWORKMANAGERQT_EXPORT quint64 eventJournalSequence();
+
+/**
+ * Retrieves every journal entry recorded after @p sequence, oldest first.
+ *
+ * @return @p false if the journal has wrapped and no longer holds all entries
+ * following @p sequence. The caller has to enumerate everything again and
+ * continue from eventJournalSequence().
+ */
+NETWORKMANAGERQT_EXPORT bool eventsSince(quint64 sequence, QList<JournalEvent> &events);
+
+/**
+ * @return the maximum number of entries kept in the event journal
+ */
+NETWORKMANAGERQT_EXPORT int eventJournalCapacity();
+
+/**
+ * Sets the maximum number of entries kept in the event journal, the oldest
+ * entries are dropped first.
+ */
+NETWORKMANAGERQT_EXPORT void setEventJournalCapacity(int capacity);
+
 }
 
 #endif
@@ -113,6 +113,18 @@ public:
     NetworkManager::Device::MeteredStatus metered() const;
     NetworkManager::DnsConfiguration globalDnsConfiguration() const;
     void setGlobalDnsConfiguration(const NetworkManager::DnsConfiguration &configuration);
+
+    // bounded event journal, entries are ordered by their sequence number
+    QList<JournalEvent> m_journal;
+    int m_journalCapacity;
+    quint64 m_journalSequence;
+    void recordEvent(JournalEvent::Type type, const QString &uni, const QString &device);
+    bool eventsSince(quint64 sequence, QList<JournalEvent> &events) const;
+    void setEventJournalCapacity(int capacity);
+    // for other private classes to feed the journal of the global manager
+    static void journal(JournalEvent::Type type, const QString &uni, const QString &device = QString());
+    // microseconds of the monotonic clock, used to timestamp state transitions
+    static qint64 monotonicTimestamp();
 protected Q_SLOTS:
     void init();
     void onDeviceAdded(const QDBusObjectPath &state);
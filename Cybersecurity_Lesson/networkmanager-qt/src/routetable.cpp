@@ -0,0 +1,638 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#include "routetable.h"
+#include "ipv4setting.h"
+#include "ipv6setting.h"
+#include "manager.h"
+
+#include <QHash>
+
+#include <algorithm>
+
+namespace
+{
+int bitAt(const NetworkManager::CompactIp &ip, int index)
+{
+    return (ip.bytes[index / 8] >> (7 - index % 8)) & 1;
+}
+
+// Number of leading bits @p a and @p b have in common, at most @p limit
+int commonPrefixLength(const NetworkManager::CompactIp &a, const NetworkManager::CompactIp &b, int limit)
+{
+    int length = 0;
+    for (int i = 0; length < limit; ++i, length += 8) {
+        const quint8 diff = a.bytes[i] ^ b.bytes[i];
+        if (diff) {
+            int bit = 0x80;
+            while (!(diff & bit)) {
+                ++length;
+                bit >>= 1;
+            }
+            return qMin(length, limit);
+        }
+    }
+    return limit;
+}
+
+NetworkManager::CompactIp masked(NetworkManager::CompactIp ip, int prefixLength)
+{
+    for (int i = 0; i < 16; ++i) {
+        const int bits = prefixLength - i * 8;
+        if (bits <= 0) {
+            ip.bytes[i] = 0;
+        } else if (bits < 8) {
+            ip.bytes[i] &= quint8(0xff << (8 - bits));
+        }
+    }
+    return ip;
+}
+
+int maxPrefixLength(const NetworkManager::CompactIp &ip)
+{
+    return ip.family == NetworkManager::CompactIp::IPv4 ? 32 : 128;
+}
+
+// Metric NetworkManager gives the routes of a device whose connection doesn't set one
+quint32 defaultRouteMetric(NetworkManager::Device::Type type)
+{
+    switch (type) {
+    case NetworkManager::Device::WireGuard:
+        return 50;
+    case NetworkManager::Device::Ethernet:
+    case NetworkManager::Device::Veth:
+        return 100;
+    case NetworkManager::Device::MacSec:
+        return 125;
+    case NetworkManager::Device::InfiniBand:
+        return 150;
+    case NetworkManager::Device::Adsl:
+        return 200;
+    case NetworkManager::Device::Wimax:
+        return 250;
+    case NetworkManager::Device::Bond:
+        return 300;
+    case NetworkManager::Device::Team:
+        return 350;
+    case NetworkManager::Device::Vlan:
+        return 400;
+    case NetworkManager::Device::MacVlan:
+        return 410;
+    case NetworkManager::Device::Bridge:
+        return 425;
+    case NetworkManager::Device::Tun:
+        return 450;
+    case NetworkManager::Device::Ppp:
+        return 460;
+    case NetworkManager::Device::VxLan:
+        return 500;
+    case NetworkManager::Device::Dummy:
+        return 550;
+    case NetworkManager::Device::Wifi:
+        return 600;
+    case NetworkManager::Device::OlpcMesh:
+        return 650;
+    case NetworkManager::Device::IpTunnel:
+        return 675;
+    case NetworkManager::Device::Modem:
+        return 700;
+    case NetworkManager::Device::Bluetooth:
+        return 750;
+    case NetworkManager::Device::Lowpan:
+        return 775;
+    case NetworkManager::Device::OvsInterface:
+        return 800;
+    case NetworkManager::Device::Wpan:
+        return 850;
+    case NetworkManager::Device::Generic:
+        return 950;
+    default:
+        return 10000;
+    }
+}
+
+// The route metric of @p device for @p type, which is Setting::Ipv4 or Setting::Ipv6
+quint32 routeMetric(const NetworkManager::Device::Ptr &device, NetworkManager::Setting::SettingType type)
+{
+    const NetworkManager::ActiveConnection::Ptr active = device->activeConnection();
+    const NetworkManager::Connection::Ptr connection = active ? active->connection() : NetworkManager::Connection::Ptr();
+    if (connection) {
+        const NetworkManager::Setting::Ptr setting = connection->settings()->setting(type);
+        int metric = -1;
+        if (type == NetworkManager::Setting::Ipv4 && setting) {
+            metric = setting.staticCast<NetworkManager::Ipv4Setting>()->routeMetric();
+        } else if (setting) {
+            metric = setting.staticCast<NetworkManager::Ipv6Setting>()->routeMetric();
+        }
+        if (metric >= 0) {
+            return quint32(metric);
+        }
+    }
+    return defaultRouteMetric(device->type());
+}
+}
+
+namespace NetworkManager
+{
+class RouteTablePrivate
+{
+public:
+    explicit RouteTablePrivate(RouteTable *q);
+
+    struct Entry {
+        CompactIp nextHop;
+        quint32 metric;
+        int device;
+    };
+
+    struct Node {
+        CompactIp key;
+        int length;
+        int child[2];
+        // sorted by metric
+        QList<Entry> entries;
+    };
+
+    struct DeviceRoutes {
+        QString uni;
+        QString interfaceName;
+        QList<CompactIpRoute> routes;
+        QList<int> nodes;
+    };
+
+    static void collectRoutes(const IpConfig &config, quint32 metric, QList<CompactIpRoute> &routes);
+    int findOrInsertNode(const CompactIp &prefix, int length);
+    void insertRoutes(int device);
+    void removeEntries(int device);
+    void rebuild();
+    int lookupNode(const CompactIp &destination) const;
+    RouteTable::Match match(int node) const;
+
+    void activeConnectionAdded(const QString &path);
+    void activeConnectionRemoved(const QString &path);
+    void trackDevice(const QString &uni);
+    void untrackDevice(const QString &uni);
+    void updateDevice(const Device::Ptr &device);
+
+    RouteTable::Mode mode;
+    QList<Node> nodes;
+    // trie roots for IPv4 and IPv6, -1 while empty
+    int roots[2];
+    int routeCount;
+    int emptyNodes;
+    QList<DeviceRoutes> devices;
+    QHash<QString, int> deviceIndex;
+    QList<int> freeDevices;
+
+    // devices of the active connections, with how many connections use each
+    QHash<QString, QStringList> activeConnectionDevices;
+    QHash<QString, int> deviceUsers;
+    QHash<QString, Device::Ptr> trackedDevices;
+
+    Q_DECLARE_PUBLIC(RouteTable)
+    RouteTable *q_ptr;
+};
+}
+
+NetworkManager::RouteTablePrivate::RouteTablePrivate(RouteTable *q)
+    : mode(RouteTable::FollowActiveConnections)
+    , roots{-1, -1}
+    , routeCount(0)
+    , emptyNodes(0)
+    , q_ptr(q)
+{
+}
+
+void NetworkManager::RouteTablePrivate::collectRoutes(const IpConfig &config, quint32 metric, QList<CompactIpRoute> &routes)
+{
+    const qsizetype first = routes.size();
+    const IpRoutes configRoutes = config.routes();
+    for (const IpRoute &configRoute : configRoutes) {
+        const CompactIpRoute route = configRoute.toCompact();
+        if (route.destination.isValid()) {
+            routes << route;
+        }
+    }
+
+    // NetworkManager usually reports the subnet and default routes in routes()
+    // already, only derive those it left out
+    auto add = [&](const CompactIp &destination, int prefixLength, const CompactIp &nextHop) {
+        const CompactIp prefix = masked(destination, prefixLength);
+        for (qsizetype i = first; i < routes.size(); ++i) {
+            const CompactIpRoute &existing = routes.at(i);
+            if (existing.prefixLength == prefixLength && masked(existing.destination, prefixLength) == prefix) {
+                return;
+            }
+        }
+        CompactIpRoute route;
+        route.destination = prefix;
+        route.prefixLength = quint8(prefixLength);
+        route.nextHop = nextHop;
+        route.metric = metric;
+        routes << route;
+    };
+
+    QList<CompactIp> gateways;
+    const CompactIp configGateway = CompactIp::fromString(config.gateway());
+    if (configGateway.isValid() && !configGateway.isUnspecified()) {
+        gateways << configGateway;
+    }
+
+    const IpAddresses addresses = config.addresses();
+    for (const IpAddress &address : addresses) {
+        const CompactIpAddress compact = address.toCompact();
+        if (!compact.address.isValid()) {
+            continue;
+        }
+        // without a known prefix only the address itself is reachable directly
+        add(compact.address, address.prefixLength() > 0 ? compact.prefixLength : maxPrefixLength(compact.address), CompactIp());
+        if (compact.gateway.isValid() && !compact.gateway.isUnspecified() && !gateways.contains(compact.gateway)) {
+            gateways << compact.gateway;
+        }
+    }
+
+    for (const CompactIp &gateway : std::as_const(gateways)) {
+        CompactIp destination;
+        destination.family = gateway.family;
+        add(destination, 0, gateway);
+    }
+}
+
+int NetworkManager::RouteTablePrivate::findOrInsertNode(const CompactIp &prefix, int length)
+{
+    const int root = prefix.family == CompactIp::IPv4 ? 0 : 1;
+    int parent = -1;
+    int side = 0;
+    int current = roots[root];
+
+    // the slot pointing at "current", either a root or a child of "parent"
+    auto link = [&](int node) {
+        if (parent < 0) {
+            roots[root] = node;
+        } else {
+            nodes[parent].child[side] = node;
+        }
+    };
+    auto newNode = [&](const CompactIp &key, int keyLength) {
+        nodes.append(Node{key, keyLength, {-1, -1}, {}});
+        ++emptyNodes;
+        return int(nodes.size() - 1);
+    };
+
+    while (true) {
+        if (current < 0) {
+            const int node = newNode(prefix, length);
+            link(node);
+            return node;
+        }
+
+        const Node &node = nodes.at(current);
+        const int common = commonPrefixLength(node.key, prefix, qMin(node.length, length));
+        if (common == node.length) {
+            if (node.length == length) {
+                return current;
+            }
+            parent = current;
+            side = bitAt(prefix, node.length);
+            current = node.child[side];
+            continue;
+        }
+
+        const int existing = current;
+        const int existingSide = bitAt(node.key, common);
+        if (common == length) {
+            // the new prefix covers the existing node
+            const int inserted = newNode(prefix, length);
+            nodes[inserted].child[existingSide] = existing;
+            link(inserted);
+            return inserted;
+        }
+
+        // the prefixes diverge, join them below a new branch node
+        const int branch = newNode(masked(prefix, common), common);
+        const int inserted = newNode(prefix, length);
+        nodes[branch].child[existingSide] = existing;
+        nodes[branch].child[existingSide ^ 1] = inserted;
+        link(branch);
+        return inserted;
+    }
+}
+
+void NetworkManager::RouteTablePrivate::insertRoutes(int device)
+{
+    DeviceRoutes &routes = devices[device];
+    routes.nodes.clear();
+    routes.nodes.reserve(routes.routes.size());
+    for (const CompactIpRoute &route : std::as_const(routes.routes)) {
+        const int length = qMin(int(route.prefixLength), maxPrefixLength(route.destination));
+        const int index = findOrInsertNode(masked(route.destination, length), length);
+        QList<Entry> &entries = nodes[index].entries;
+        if (entries.isEmpty()) {
+            --emptyNodes;
+        }
+        auto it = std::upper_bound(entries.begin(), entries.end(), route.metric, [](quint32 metric, const Entry &entry) {
+            return metric < entry.metric;
+        });
+        entries.insert(it, Entry{route.nextHop, route.metric, device});
+        routes.nodes << index;
+        ++routeCount;
+    }
+}
+
+void NetworkManager::RouteTablePrivate::removeEntries(int device)
+{
+    DeviceRoutes &routes = devices[device];
+    for (int index : std::as_const(routes.nodes)) {
+        QList<Entry> &entries = nodes[index].entries;
+        const qsizetype removed = entries.removeIf([device](const Entry &entry) {
+            return entry.device == device;
+        });
+        routeCount -= removed;
+        if (removed && entries.isEmpty()) {
+            ++emptyNodes;
+        }
+    }
+    routes.nodes.clear();
+    routes.routes.clear();
+
+    // nodes are never unlinked, drop the dead ones once they make up most of the trie
+    if (emptyNodes > 64 && emptyNodes * 2 > nodes.size()) {
+        rebuild();
+    }
+}
+
+void NetworkManager::RouteTablePrivate::rebuild()
+{
+    nodes.clear();
+    roots[0] = roots[1] = -1;
+    routeCount = 0;
+    emptyNodes = 0;
+    for (int i = 0; i < devices.size(); ++i) {
+        if (!devices.at(i).uni.isEmpty()) {
+            insertRoutes(i);
+        }
+    }
+}
+
+int NetworkManager::RouteTablePrivate::lookupNode(const CompactIp &destination) const
+{
+    if (!destination.isValid()) {
+        return -1;
+    }
+
+    int best = -1;
+    int current = roots[destination.family == CompactIp::IPv4 ? 0 : 1];
+    const int maxLength = maxPrefixLength(destination);
+    while (current >= 0) {
+        const Node &node = nodes.at(current);
+        if (commonPrefixLength(node.key, destination, node.length) < node.length) {
+            break;
+        }
+        if (!node.entries.isEmpty()) {
+            best = current;
+        }
+        if (node.length >= maxLength) {
+            break;
+        }
+        current = node.child[bitAt(destination, node.length)];
+    }
+    return best;
+}
+
+NetworkManager::RouteTable::Match NetworkManager::RouteTablePrivate::match(int node) const
+{
+    RouteTable::Match match;
+    if (node < 0) {
+        return match;
+    }
+
+    const Node &found = nodes.at(node);
+    const Entry &entry = found.entries.constFirst();
+    const DeviceRoutes &device = devices.at(entry.device);
+    match.deviceUni = device.uni;
+    match.interfaceName = device.interfaceName;
+    match.route.destination = found.key;
+    match.route.prefixLength = quint8(found.length);
+    match.route.nextHop = entry.nextHop;
+    match.route.metric = entry.metric;
+    return match;
+}
+
+void NetworkManager::RouteTablePrivate::activeConnectionAdded(const QString &path)
+{
+    const ActiveConnection::Ptr active = findActiveConnection(path);
+    if (!active || activeConnectionDevices.contains(path)) {
+        return;
+    }
+
+    const QStringList unis = active->devices();
+    activeConnectionDevices.insert(path, unis);
+    for (const QString &uni : unis) {
+        if (deviceUsers[uni]++ == 0) {
+            trackDevice(uni);
+        }
+    }
+}
+
+void NetworkManager::RouteTablePrivate::activeConnectionRemoved(const QString &path)
+{
+    const QStringList unis = activeConnectionDevices.take(path);
+    for (const QString &uni : unis) {
+        auto it = deviceUsers.find(uni);
+        if (it != deviceUsers.end() && --it.value() == 0) {
+            deviceUsers.erase(it);
+            untrackDevice(uni);
+        }
+    }
+}
+
+void NetworkManager::RouteTablePrivate::trackDevice(const QString &uni)
+{
+    Q_Q(RouteTable);
+
+    const Device::Ptr device = findNetworkInterface(uni);
+    if (!device) {
+        return;
+    }
+
+    trackedDevices.insert(uni, device);
+    Device *object = device.data();
+    auto update = [this, object]() {
+        updateDevice(trackedDevices.value(object->uni()));
+    };
+    QObject::connect(object, &Device::ipV4ConfigChanged, q, update);
+    QObject::connect(object, &Device::ipV6ConfigChanged, q, update);
+    updateDevice(device);
+}
+
+void NetworkManager::RouteTablePrivate::untrackDevice(const QString &uni)
+{
+    Q_Q(RouteTable);
+
+    const Device::Ptr device = trackedDevices.take(uni);
+    if (device) {
+        QObject::disconnect(device.data(), nullptr, q, nullptr);
+    }
+    q->removeRoutes(uni);
+}
+
+void NetworkManager::RouteTablePrivate::updateDevice(const Device::Ptr &device)
+{
+    Q_Q(RouteTable);
+
+    if (device) {
+        q->setRoutes(device->uni(),
+                     device->ipInterfaceName(),
+                     device->ipV4Config(),
+                     device->ipV6Config(),
+                     routeMetric(device, Setting::Ipv4),
+                     routeMetric(device, Setting::Ipv6));
+    }
+}
+
+NetworkManager::RouteTable::RouteTable(Mode mode, QObject *parent)
+    : QObject(parent)
+    , d_ptr(new RouteTablePrivate(this))
+{
+    Q_D(RouteTable);
+
+    d->mode = mode;
+    if (mode != FollowActiveConnections) {
+        return;
+    }
+
+    connect(notifier(), &Notifier::activeConnectionAdded, this, [d](const QString &path) {
+        d->activeConnectionAdded(path);
+    });
+    connect(notifier(), &Notifier::activeConnectionRemoved, this, [d](const QString &path) {
+        d->activeConnectionRemoved(path);
+    });
+    const ActiveConnection::List active = activeConnections();
+    for (const ActiveConnection::Ptr &connection : active) {
+        d->activeConnectionAdded(connection->path());
+    }
+}
+
+NetworkManager::RouteTable::~RouteTable()
+{
+    delete d_ptr;
+}
+
+NetworkManager::RouteTable::Mode NetworkManager::RouteTable::mode() const
+{
+    Q_D(const RouteTable);
+
+    return d->mode;
+}
+
+void NetworkManager::RouteTable::setRoutes(const QString &deviceUni,
+                                          const QString &interfaceName,
+                                          const IpConfig &ipV4Config,
+                                          const IpConfig &ipV6Config,
+                                          quint32 ipV4RouteMetric,
+                                          quint32 ipV6RouteMetric)
+{
+    Q_D(RouteTable);
+
+    QList<CompactIpRoute> routes;
+    RouteTablePrivate::collectRoutes(ipV4Config, ipV4RouteMetric, routes);
+    RouteTablePrivate::collectRoutes(ipV6Config, ipV6RouteMetric, routes);
+
+    int device = d->deviceIndex.value(deviceUni, -1);
+    if (device >= 0) {
+        d->removeEntries(device);
+    } else if (!routes.isEmpty()) {
+        if (!d->freeDevices.isEmpty()) {
+            device = d->freeDevices.takeLast();
+        } else {
+            device = d->devices.size();
+            d->devices.append(RouteTablePrivate::DeviceRoutes());
+        }
+        d->deviceIndex.insert(deviceUni, device);
+        d->devices[device].uni = deviceUni;
+    } else {
+        return;
+    }
+
+    if (routes.isEmpty()) {
+        d->devices[device] = RouteTablePrivate::DeviceRoutes();
+        d->deviceIndex.remove(deviceUni);
+        d->freeDevices << device;
+    } else {
+        d->devices[device].interfaceName = interfaceName;
+        d->devices[device].routes = routes;
+        d->insertRoutes(device);
+    }
+    Q_EMIT routesChanged();
+}
+
+void NetworkManager::RouteTable::removeRoutes(const QString &deviceUni)
+{
+    setRoutes(deviceUni, QString(), IpConfig(), IpConfig());
+}
+
+void NetworkManager::RouteTable::clear()
+{
+    Q_D(RouteTable);
+
+    if (d->devices.isEmpty()) {
+        return;
+    }
+
+    d->devices.clear();
+    d->deviceIndex.clear();
+    d->freeDevices.clear();
+    d->rebuild();
+    Q_EMIT routesChanged();
+}
+
+int NetworkManager::RouteTable::count() const
+{
+    Q_D(const RouteTable);
+
+    return d->routeCount;
+}
+
+QStringList NetworkManager::RouteTable::devices() const
+{
+    Q_D(const RouteTable);
+
+    return d->deviceIndex.keys();
+}
+
+NetworkManager::RouteTable::Match NetworkManager::RouteTable::lookup(const CompactIp &destination) const
+{
+    Q_D(const RouteTable);
+
+    return d->match(d->lookupNode(destination));
+}
+
+NetworkManager::RouteTable::Match NetworkManager::RouteTable::lookup(const QHostAddress &destination) const
+{
+    return lookup(CompactIp::fromHostAddress(destination));
+}
+
+QList<NetworkManager::RouteTable::Match> NetworkManager::RouteTable::lookup(const QList<CompactIp> &destinations) const
+{
+    Q_D(const RouteTable);
+
+    QList<Match> matches;
+    matches.reserve(destinations.size());
+    for (const CompactIp &destination : destinations) {
+        matches << d->match(d->lookupNode(destination));
+    }
+    return matches;
+}
+
+QList<NetworkManager::RouteTable::Match> NetworkManager::RouteTable::lookup(const QList<QHostAddress> &destinations) const
+{
+    QList<CompactIp> compact;
+    compact.reserve(destinations.size());
+    for (const QHostAddress &destination : destinations) {
+        compact << CompactIp::fromHostAddress(destination);
+    }
+    return lookup(compact);
+}
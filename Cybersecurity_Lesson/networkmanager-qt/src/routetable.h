@@ -0,0 +1,139 @@
+/*
+    SPDX-FileCopyrightText: 2026 agent <agent@local>
+
+    SPDX-License-Identifier: LGPL-2.1-only OR LGPL-3.0-only OR LicenseRef-KDE-Accepted-LGPL
+*/
+
+#ifndef NETWORKMANAGERQT_ROUTE_TABLE_H
+#define NETWORKMANAGERQT_ROUTE_TABLE_H
+
+#include <networkmanagerqt/networkmanagerqt_export.h>
+
+#include "compactip.h"
+#include "ipconfig.h"
+
+#include <QObject>
+
+namespace NetworkManager
+{
+class RouteTablePrivate;
+
+/**
+ * Longest prefix match index over the IPv4 and IPv6 routes of devices.
+ *
+ * Answers which interface and next hop a destination would be sent through,
+ * according to the IP configuration NetworkManager reports. The routes of a
+ * device are IpConfig::routes(); the route to the subnet of each address and
+ * the default route via the gateway are added with the device's route metric
+ * when routes() doesn't list them. Among routes of equal prefix length the one
+ * with the lowest metric wins.
+ *
+ * The routes are kept in a path compressed binary trie per address family,
+ * so a lookup visits at most one node per distinct prefix length on the way
+ * to the destination. When a device's IP configuration changes only its own
+ * routes are replaced.
+ *
+ * @since 5.94.0
+ */
+class NETWORKMANAGERQT_EXPORT RouteTable : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY routesChanged)
+
+public:
+    enum Mode {
+        /**
+         * Follows the devices of all active connections and their IP configuration
+         */
+        FollowActiveConnections,
+        /**
+         * Only contains the routes passed to setRoutes()
+         */
+        Manual,
+    };
+
+    /**
+     * Result of a lookup
+     */
+    struct Match {
+        /**
+         * Unique identifier of the device owning the route
+         */
+        QString deviceUni;
+        /**
+         * IP interface name of the device
+         */
+        QString interfaceName;
+        /**
+         * The matching route, its next hop is unspecified for directly connected destinations
+         */
+        CompactIpRoute route;
+
+        /**
+         * Returns false if no route matched
+         */
+        bool isValid() const
+        {
+            return route.destination.isValid();
+        }
+    };
+
+    explicit RouteTable(Mode mode = FollowActiveConnections, QObject *parent = nullptr);
+    ~RouteTable() override;
+
+    Mode mode() const;
+
+    /**
+     * Replaces the routes of the device @p deviceUni by those derived from
+     * @p ipV4Config and @p ipV6Config. Subnet and default routes missing from
+     * IpConfig::routes() get @p ipV4RouteMetric or @p ipV6RouteMetric.
+     */
+    void setRoutes(const QString &deviceUni,
+                   const QString &interfaceName,
+                   const IpConfig &ipV4Config,
+                   const IpConfig &ipV6Config,
+                   quint32 ipV4RouteMetric = 0,
+                   quint32 ipV6RouteMetric = 0);
+    /**
+     * Removes the routes of the device @p deviceUni
+     */
+    void removeRoutes(const QString &deviceUni);
+    /**
+     * Removes all routes
+     */
+    void clear();
+
+    /**
+     * Returns the number of routes in the table
+     */
+    int count() const;
+    /**
+     * Returns the devices which contribute routes
+     */
+    QStringList devices() const;
+
+    /**
+     * Returns the route @p destination would be sent through
+     */
+    Match lookup(const CompactIp &destination) const;
+    Match lookup(const QHostAddress &destination) const;
+    /**
+     * Looks up each of @p destinations, the matches are in the same order
+     */
+    QList<Match> lookup(const QList<CompactIp> &destinations) const;
+    QList<Match> lookup(const QList<QHostAddress> &destinations) const;
+
+Q_SIGNALS:
+    /**
+     * Emitted when the routes of a device were added, replaced or removed
+     */
+    void routesChanged();
+
+private:
+    Q_DECLARE_PRIVATE(RouteTable)
+    RouteTablePrivate *const d_ptr;
+};
+
+}
+
+#endif // NETWORKMANAGERQT_ROUTE_TABLE_H
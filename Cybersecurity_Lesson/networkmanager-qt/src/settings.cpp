@@ -115,6 +115,12 @@ QDBusPendingReply<QDBusObjectPath> NetworkManager::SettingsPrivate::addConnectio
     return iface.AddConnectionUnsaved(connection);
 }
 
+QDBusPendingReply<QDBusObjectPath, QVariantMap>
+NetworkManager::SettingsPrivate::addConnection2(const NMVariantMapMap &connection, uint flags, const QVariantMap &args)
+{
+    return iface.AddConnection2(connection, flags, args);
+}
+
 QDBusPendingReply<bool, QStringList> NetworkManager::SettingsPrivate::loadConnections(const QStringList &filenames)
 {
     return iface.LoadConnections(filenames);
@@ -173,6 +179,7 @@ void NetworkManager::SettingsPrivate::onConnectionAdded(const QDBusObjectPath &p
         return;
     }
     connections.insert(id, Connection::Ptr());
+    NetworkManagerPrivate::journal(JournalEvent::ConnectionAdded, id);
     Q_EMIT connectionAdded(id);
 }
 
@@ -187,6 +194,9 @@ NetworkManager::Connection::Ptr NetworkManager::SettingsPrivate::findRegisteredC
             ret = Connection::Ptr(new Connection(path), &QObject::deleteLater);
             connections[path] = ret;
             connect(ret.data(), SIGNAL(removed(QString)), this, SLOT(onConnectionRemoved(QString)));
+            connect(ret.data(), &Connection::updated, this, [path]() {
+                NetworkManagerPrivate::journal(JournalEvent::ConnectionUpdated, path);
+            });
             if (!contains) {
                 Q_EMIT connectionAdded(path);
             }
@@ -202,7 +212,9 @@ void NetworkManager::SettingsPrivate::onConnectionRemoved(const QDBusObjectPath
 
 void NetworkManager::SettingsPrivate::onConnectionRemoved(const QString &path)
 {
-    connections.remove(path);
+    if (connections.remove(path)) {
+        NetworkManagerPrivate::journal(JournalEvent::ConnectionRemoved, path);
+    }
     Q_EMIT connectionRemoved(path);
 }
 
@@ -236,6 +248,11 @@ QDBusPendingReply<QDBusObjectPath> NetworkManager::addConnectionUnsaved(const NM
     return globalSettings->addConnectionUnsaved(connection);
 }
 
+QDBusPendingReply<QDBusObjectPath, QVariantMap> NetworkManager::addConnection2(const NMVariantMapMap &connection, uint flags, const QVariantMap &args)
+{
+    return globalSettings->addConnection2(connection, flags, args);
+}
+
 QDBusPendingReply<bool, QStringList> NetworkManager::loadConnections(const QStringList &filenames)
 {
     return globalSettings->loadConnections(filenames);
@@ -102,6 +102,19 @@ NETWORKMANAGERQT_EXPORT QDBusPendingReply<QDBusObjectPath> addConnection(const N
  */
 NETWORKMANAGERQT_EXPORT QDBusPendingReply<QDBusObjectPath> addConnectionUnsaved(const NMVariantMapMap &settings);
 
+/**
+ * Add new connection through the AddConnection2 method, available since NetworkManager 1.20.
+ * @p flags is a combination of NMSettingsAddConnection2Flags and @p args holds the
+ * optional arguments of the call. The reply carries the path of the new connection
+ * and the result dictionary returned by NetworkManager.
+ *
+ * @see ConnectionImport for adding many connections at once
+ *
+ * @since 5.94.0
+ */
+NETWORKMANAGERQT_EXPORT QDBusPendingReply<QDBusObjectPath, QVariantMap>
+addConnection2(const NMVariantMapMap &settings, uint flags, const QVariantMap &args = QVariantMap());
+
 /**
  * Retrieves the connection for the given @p uuid, returns null if not found
  */
@@ -25,16 +25,22 @@ NetworkManager::BridgePortSetting::BridgePortSetting()
 
 NetworkManager::BridgePortSetting::BridgePortSetting(const NetworkManager::BridgePortSetting::Ptr &other)
     : Setting(other)
-    , d_ptr(new BridgePortSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setPriority(other->priority());
-    setPathCost(other->pathCost());
-    setHairpinMode(other->hairpinMode());
 }
 
 NetworkManager::BridgePortSetting::~BridgePortSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::BridgePortSettingPrivate *NetworkManager::BridgePortSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::BridgePortSettingPrivate *NetworkManager::BridgePortSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::BridgePortSetting::name() const
@@ -44,10 +44,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    BridgePortSettingPrivate *d_ptr;
+    QSharedDataPointer<BridgePortSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(BridgePortSetting)
+    BridgePortSettingPrivate *d_func();
+    const BridgePortSettingPrivate *d_func() const;
+    friend class BridgePortSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const BridgePortSetting &setting);
@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_BRIDGEPORT_SETTING_P_H
 #define NETWORKMANAGERQT_BRIDGEPORT_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class BridgePortSettingPrivate
+class BridgePortSettingPrivate : public QSharedData
 {
 public:
     BridgePortSettingPrivate();
@@ -31,22 +31,22 @@ NetworkManager::BridgeSetting::BridgeSetting()
 
 NetworkManager::BridgeSetting::BridgeSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new BridgeSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setInterfaceName(other->interfaceName());
-    setStp(other->stp());
-    setPriority(other->priority());
-    setForwardDelay(other->forwardDelay());
-    setHelloTime(other->helloTime());
-    setMaxAge(other->maxAge());
-    setAgingTime(other->agingTime());
-    setMulticastSnooping(other->multicastSnooping());
-    setMacAddress(other->macAddress());
 }
 
 NetworkManager::BridgeSetting::~BridgeSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::BridgeSettingPrivate *NetworkManager::BridgeSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::BridgeSettingPrivate *NetworkManager::BridgeSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::BridgeSetting::name() const
@@ -63,10 +63,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    BridgeSettingPrivate *d_ptr;
+    QSharedDataPointer<BridgeSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(BridgeSetting)
+    BridgeSettingPrivate *d_func();
+    const BridgeSettingPrivate *d_func() const;
+    friend class BridgeSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const BridgeSetting &setting);
@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_BRIDGE_SETTING_P_H
 #define NETWORKMANAGERQT_BRIDGE_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class BridgeSettingPrivate
+class BridgeSettingPrivate : public QSharedData
 {
 public:
     BridgeSettingPrivate();
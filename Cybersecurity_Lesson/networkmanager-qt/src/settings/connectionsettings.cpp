@@ -12,7 +12,11 @@
 #include "bridgesetting.h"
 #include "ipv4setting.h"
 #include "ipv6setting.h"
+#include "macsecsetting.h"
+#include "matchsetting.h"
 #include "security8021xsetting.h"
+#include "tcsetting.h"
+#include "usersetting.h"
 #include "wiredsetting.h"
 #include "wirelesssecuritysetting.h"
 #include "wirelesssetting.h"
@@ -33,6 +37,7 @@
 
 #include "genericsetting.h"
 
+#include <QDBusArgument>
 #include <QUuid>
 
 namespace NetworkManager
@@ -40,7 +45,118 @@ namespace NetworkManager
 extern int checkVersion(const int x, const int y, const int z);
 }
 
-NetworkManager::ConnectionSettingsPrivate::ConnectionSettingsPrivate(ConnectionSettings *q)
+namespace
+{
+// The ipv6 structs have no operator==, compare their fields instead
+QVariant comparableAddresses(const IpV6DBusAddressList &addresses)
+{
+    QVariantList result;
+    for (const IpV6DBusAddress &address : addresses) {
+        result << QVariant(QVariantList{address.address, address.prefix, address.gateway});
+    }
+    return result;
+}
+
+QVariant comparableRoutes(const IpV6DBusRouteList &routes)
+{
+    QVariantList result;
+    for (const IpV6DBusRoute &route : routes) {
+        result << QVariant(QVariantList{route.destination, route.prefix, route.nexthop, route.metric});
+    }
+    return result;
+}
+
+// Containers received over D-Bus stay wrapped in a QDBusArgument, which never
+// compares equal, so bring the ones used by settings into their typed form
+QVariant comparableValue(const QVariant &value)
+{
+    if (value.userType() == qMetaTypeId<IpV6DBusAddressList>()) {
+        return comparableAddresses(value.value<IpV6DBusAddressList>());
+    } else if (value.userType() == qMetaTypeId<IpV6DBusRouteList>()) {
+        return comparableRoutes(value.value<IpV6DBusRouteList>());
+    } else if (value.userType() != qMetaTypeId<QDBusArgument>()) {
+        return value;
+    }
+
+    const QDBusArgument argument = value.value<QDBusArgument>();
+    const QString signature = argument.currentSignature();
+    if (signature == QLatin1String("aa{sv}")) {
+        return QVariant::fromValue(qdbus_cast<NMVariantMapList>(argument));
+    } else if (signature == QLatin1String("aau")) {
+        return QVariant::fromValue(qdbus_cast<UIntListList>(argument));
+    } else if (signature == QLatin1String("au")) {
+        return QVariant::fromValue(qdbus_cast<UIntList>(argument));
+    } else if (signature == QLatin1String("as")) {
+        return QVariant::fromValue(qdbus_cast<QStringList>(argument));
+    } else if (signature == QLatin1String("aay")) {
+        return QVariant::fromValue(qdbus_cast<QList<QByteArray>>(argument));
+    } else if (signature == QLatin1String("a{ss}")) {
+        return QVariant::fromValue(qdbus_cast<NMStringMap>(argument));
+    } else if (signature == QLatin1String("a{sv}")) {
+        return QVariant::fromValue(qdbus_cast<QVariantMap>(argument));
+    } else if (signature == QLatin1String("a(ayuay)")) {
+        return comparableAddresses(qdbus_cast<IpV6DBusAddressList>(argument));
+    } else if (signature == QLatin1String("a(ayuayu)")) {
+        return comparableRoutes(qdbus_cast<IpV6DBusRouteList>(argument));
+    }
+
+    return value;
+}
+
+bool isSameValue(const QVariant &a, const QVariant &b)
+{
+    // certificates and other shared blobs, the contents needn't be compared when the data is the same
+    if (a.userType() == QMetaType::QByteArray && b.userType() == QMetaType::QByteArray) {
+        const QByteArray first = a.toByteArray();
+        const QByteArray second = b.toByteArray();
+        if (first.constData() == second.constData() && first.size() == second.size()) {
+            return true;
+        }
+    }
+    return comparableValue(a) == comparableValue(b);
+}
+
+// A new setting object of the same type, its data is shared until either of them is modified
+NetworkManager::Setting::Ptr copySetting(const NetworkManager::Setting::Ptr &setting)
+{
+    using namespace NetworkManager;
+
+    switch (setting->type()) {
+    case Setting::Ipv4:
+        return Setting::Ptr(new Ipv4Setting(setting.staticCast<Ipv4Setting>()));
+    case Setting::Ipv6:
+        return Setting::Ptr(new Ipv6Setting(setting.staticCast<Ipv6Setting>()));
+    case Setting::Security8021x:
+        return Setting::Ptr(new Security8021xSetting(setting.staticCast<Security8021xSetting>()));
+    case Setting::Wired:
+        return Setting::Ptr(new WiredSetting(setting.staticCast<WiredSetting>()));
+    case Setting::Wireless:
+        return Setting::Ptr(new WirelessSetting(setting.staticCast<WirelessSetting>()));
+    case Setting::WirelessSecurity:
+        return Setting::Ptr(new WirelessSecuritySetting(setting.staticCast<WirelessSecuritySetting>()));
+    case Setting::Bridge:
+        return Setting::Ptr(new BridgeSetting(setting.staticCast<BridgeSetting>()));
+    case Setting::BridgePort:
+        return Setting::Ptr(new BridgePortSetting(setting.staticCast<BridgePortSetting>()));
+    case Setting::Generic:
+        return Setting::Ptr(new GenericSetting(setting.staticCast<GenericSetting>()));
+    case Setting::User:
+        return Setting::Ptr(new UserSetting(setting.staticCast<UserSetting>()));
+    case Setting::Match:
+        return Setting::Ptr(new MatchSetting(setting.staticCast<MatchSetting>()));
+    case Setting::Tc:
+        return Setting::Ptr(new TcSetting(setting.staticCast<TcSetting>()));
+    case Setting::Macsec:
+        return Setting::Ptr(new MacsecSetting(setting.staticCast<MacsecSetting>()));
+    case Setting::Proxy:
+        break;
+    }
+
+    return Setting::Ptr(new Setting(setting));
+}
+}
+
+NetworkManager::ConnectionSettingsPrivate::ConnectionSettingsPrivate()
     : name(NM_SETTING_CONNECTION_SETTING_NAME)
     , uuid(QUuid().toString())
     , type(ConnectionSettings::Wired)
@@ -53,10 +169,40 @@ NetworkManager::ConnectionSettingsPrivate::ConnectionSettingsPrivate(ConnectionS
     , lldp(ConnectionSettings::LldpDefault)
     , metered(ConnectionSettings::MeteredUnknown)
     , mdns(ConnectionSettings::MdnsDefault)
-    , q_ptr(q)
 {
 }
 
+NetworkManager::ConnectionSettingsPrivate::ConnectionSettingsPrivate(const ConnectionSettingsPrivate &other)
+    : QSharedData(other)
+    , name(other.name)
+    , id(other.id)
+    , uuid(other.uuid)
+    , interfaceName(other.interfaceName)
+    , type(other.type)
+    , permissions(other.permissions)
+    , autoconnect(other.autoconnect)
+    , timestamp(other.timestamp)
+    , readOnly(other.readOnly)
+    , zone(other.zone)
+    , master(other.master)
+    , slaveType(other.slaveType)
+    , secondaries(other.secondaries)
+    , gatewayPingTimeout(other.gatewayPingTimeout)
+    , autoconnectPriority(other.autoconnectPriority)
+    , autoconnectRetries(other.autoconnectRetries)
+    , autoconnectSlaves(other.autoconnectSlaves)
+    , lldp(other.lldp)
+    , metered(other.metered)
+    , mdns(other.mdns)
+    , stableId(other.stableId)
+{
+    // setting() hands the objects out for modification, so each copy needs its own
+    settings.reserve(other.settings.count());
+    for (const Setting::Ptr &setting : other.settings) {
+        settings.push_back(copySetting(setting));
+    }
+}
+
 void NetworkManager::ConnectionSettingsPrivate::addSetting(const NetworkManager::Setting::Ptr &setting)
 {
     settings.push_back(setting);
@@ -97,44 +243,10 @@ void NetworkManager::ConnectionSettingsPrivate::initSettings(NMBluetoothCapabili
         break;
     case ConnectionSettings::Unknown:
     default:
-        break;
+        return;
     }
-}
-
-void NetworkManager::ConnectionSettingsPrivate::initSettings(const NetworkManager::ConnectionSettings::Ptr &connectionSettings)
-{
-    Q_Q(ConnectionSettings);
 
-    clearSettings();
-
-    switch (type) {
-    case ConnectionSettings::Bridge:
-        addSetting(connectionSettings->setting(Setting::Bridge));
-        addSetting(connectionSettings->setting(Setting::Ipv4));
-        addSetting(connectionSettings->setting(Setting::Ipv6));
-        break;
-    case ConnectionSettings::Wired:
-        addSetting(connectionSettings->setting(Setting::Ipv4));
-        addSetting(connectionSettings->setting(Setting::Ipv6));
-        addSetting(connectionSettings->setting(Setting::Security8021x));
-        addSetting(connectionSettings->setting(Setting::Wired));
-        break;
-    case ConnectionSettings::Wireless:
-        addSetting(connectionSettings->setting(Setting::Ipv4));
-        addSetting(connectionSettings->setting(Setting::Ipv6));
-        addSetting(connectionSettings->setting(Setting::Security8021x));
-        addSetting(connectionSettings->setting(Setting::Wireless));
-        addSetting(connectionSettings->setting(Setting::WirelessSecurity));
-        break;
-    case ConnectionSettings::Generic:
-        addSetting(connectionSettings->setting(Setting::Generic));
-        addSetting(connectionSettings->setting(Setting::Ipv4));
-        addSetting(connectionSettings->setting(Setting::Ipv6));
-        break;
-    case ConnectionSettings::Unknown:
-    default:
-        break;
-    }
+    addSetting(Setting::Ptr(new MatchSetting()));
 }
 
 NetworkManager::ConnectionSettings::ConnectionType NetworkManager::ConnectionSettings::typeFromString(const QString &typeString)
@@ -184,55 +296,42 @@ QString NetworkManager::ConnectionSettings::createNewUuid()
 }
 
 NetworkManager::ConnectionSettings::ConnectionSettings()
-    : d_ptr(new ConnectionSettingsPrivate(this))
+    : d_ptr(new ConnectionSettingsPrivate())
 {
 }
 
 NetworkManager::ConnectionSettings::ConnectionSettings(NetworkManager::ConnectionSettings::ConnectionType type, NMBluetoothCapabilities bt_cap)
-    : d_ptr(new ConnectionSettingsPrivate(this))
+    : d_ptr(new ConnectionSettingsPrivate())
 {
     setConnectionType(type, bt_cap);
 }
 
 NetworkManager::ConnectionSettings::ConnectionSettings(const NetworkManager::ConnectionSettings::Ptr &other)
-    : d_ptr(new ConnectionSettingsPrivate(this))
+    : d_ptr(other->d_ptr)
 {
-    Q_D(ConnectionSettings);
-
-    setId(other->id());
-    setUuid(other->uuid());
-    setInterfaceName(other->interfaceName());
-    setConnectionType(other->connectionType());
-    setPermissions(other->permissions());
-    setAutoconnect(other->autoconnect());
-    setAutoconnectPriority(other->autoconnectPriority());
-    setTimestamp(other->timestamp());
-    setReadOnly(other->readOnly());
-    setZone(other->zone());
-    setMaster(other->master());
-    setSlaveType(other->slaveType());
-    setGatewayPingTimeout(other->gatewayPingTimeout());
-    setAutoconnectRetries(other->autoconnectRetries());
-    setAutoconnectSlaves(other->autoconnectSlaves());
-    setLldp(other->lldp());
-    setMetered(other->metered());
-    setMdns(other->mdns());
-    setStableId(other->stableId());
-
-    d->initSettings(other);
+    // setting() is const and would hand out the setting objects of other,
+    // detach now so that the copy owns its settings
+    d_ptr.detach();
 }
 
 NetworkManager::ConnectionSettings::ConnectionSettings(const NMVariantMapMap &map)
-    : d_ptr(new ConnectionSettingsPrivate(this))
+    : d_ptr(new ConnectionSettingsPrivate())
 {
     fromMap(map);
 }
 
 NetworkManager::ConnectionSettings::~ConnectionSettings()
 {
-    d_ptr->clearSettings();
+}
 
-    delete d_ptr;
+NetworkManager::ConnectionSettingsPrivate *NetworkManager::ConnectionSettings::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::ConnectionSettingsPrivate *NetworkManager::ConnectionSettings::d_func() const
+{
+    return d_ptr.constData();
 }
 
 void NetworkManager::ConnectionSettings::fromMap(const NMVariantMapMap &map)
@@ -425,6 +524,50 @@ NMVariantMapMap NetworkManager::ConnectionSettings::toMap() const
     return result;
 }
 
+NMVariantMapMap NetworkManager::ConnectionSettings::diff(const NMVariantMapMap &from, const NMVariantMapMap &to)
+{
+    NMVariantMapMap result;
+
+    for (auto it = to.constBegin(); it != to.constEnd(); ++it) {
+        const QVariantMap oldSetting = from.value(it.key());
+        QVariantMap changes;
+
+        for (auto key = it->constBegin(); key != it->constEnd(); ++key) {
+            const auto oldValue = oldSetting.constFind(key.key());
+            if (oldValue == oldSetting.constEnd() || !isSameValue(*oldValue, *key)) {
+                changes.insert(key.key(), *key);
+            }
+        }
+
+        for (auto key = oldSetting.constBegin(); key != oldSetting.constEnd(); ++key) {
+            if (!it->contains(key.key())) {
+                changes.insert(key.key(), QVariant());
+            }
+        }
+
+        if (!changes.isEmpty()) {
+            result.insert(it.key(), changes);
+        }
+    }
+
+    for (auto it = from.constBegin(); it != from.constEnd(); ++it) {
+        if (!to.contains(it.key())) {
+            QVariantMap removed;
+            for (auto key = it->constBegin(); key != it->constEnd(); ++key) {
+                removed.insert(key.key(), QVariant());
+            }
+            result.insert(it.key(), removed);
+        }
+    }
+
+    return result;
+}
+
+NMVariantMapMap NetworkManager::ConnectionSettings::diff(const NetworkManager::ConnectionSettings::Ptr &other) const
+{
+    return diff(toMap(), other->toMap());
+}
+
 QString NetworkManager::ConnectionSettings::name() const
 {
     Q_D(const ConnectionSettings);
@@ -794,6 +937,9 @@ QDebug NetworkManager::operator<<(QDebug dbg, const NetworkManager::ConnectionSe
         case Setting::Ipv6:
             dbg.nospace() << *(settingPtr.staticCast<NetworkManager::Ipv6Setting>().data());
             break;
+        case Setting::Match:
+            dbg.nospace() << *(settingPtr.staticCast<NetworkManager::MatchSetting>().data());
+            break;
         case Setting::Security8021x:
             dbg.nospace() << *(settingPtr.staticCast<NetworkManager::Security8021xSetting>().data());
             break;
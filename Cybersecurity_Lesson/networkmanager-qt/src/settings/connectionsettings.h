@@ -90,6 +90,11 @@ public:
 
     ConnectionSettings();
     explicit ConnectionSettings(ConnectionType type, NMBluetoothCapabilities bt_cap = NM_BT_CAPABILITY_DUN);
+    /**
+     * Constructs a copy of @p other. The copy gets its own setting objects,
+     * whose data is implicitly shared with the ones of @p other and only
+     * detached for the settings which are modified.
+     */
     explicit ConnectionSettings(const ConnectionSettings::Ptr &other);
     explicit ConnectionSettings(const NMVariantMapMap &map);
     virtual ~ConnectionSettings();
@@ -100,6 +105,23 @@ public:
 
     NMVariantMapMap toMap() const;
 
+    /**
+     * Returns the keys of every setting that differ between @p from and @p to.
+     * Changed and added keys hold their value from @p to, keys that only exist
+     * in @p from hold an invalid QVariant. Settings without any difference are
+     * left out, settings missing from @p to are included with all their keys.
+     *
+     * @since 5.94.0
+     */
+    static NMVariantMapMap diff(const NMVariantMapMap &from, const NMVariantMapMap &to);
+
+    /**
+     * Returns the difference from this connection to @p other, see diff(const NMVariantMapMap &, const NMVariantMapMap &).
+     *
+     * @since 5.94.0
+     */
+    NMVariantMapMap diff(const ConnectionSettings::Ptr &other) const;
+
     void setId(const QString &id);
     QString id() const;
 
@@ -169,10 +191,12 @@ public:
     Setting::List settings() const;
 
 protected:
-    ConnectionSettingsPrivate *d_ptr;
+    QSharedDataPointer<ConnectionSettingsPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(ConnectionSettings)
+    ConnectionSettingsPrivate *d_func();
+    const ConnectionSettingsPrivate *d_func() const;
+    friend class ConnectionSettingsPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const ConnectionSettings &setting);
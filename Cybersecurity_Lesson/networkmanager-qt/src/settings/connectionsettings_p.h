@@ -11,21 +11,20 @@
 
 #include <QDateTime>
 #include <QHash>
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class ConnectionSettingsPrivate
+class ConnectionSettingsPrivate : public QSharedData
 {
 public:
-    Q_DECLARE_PUBLIC(ConnectionSettings)
-
-    explicit ConnectionSettingsPrivate(ConnectionSettings *q);
+    ConnectionSettingsPrivate();
+    ConnectionSettingsPrivate(const ConnectionSettingsPrivate &other);
 
     void addSetting(const NetworkManager::Setting::Ptr &setting);
     void clearSettings();
     void initSettings(NMBluetoothCapabilities bt_cap);
-    void initSettings(const NetworkManager::ConnectionSettings::Ptr &connectionSettings);
 
     QString name;
     QString id;
@@ -48,9 +47,8 @@ public:
     NetworkManager::ConnectionSettings::Metered metered;
     NetworkManager::ConnectionSettings::Mdns mdns;
     QString stableId;
+    // copied on detach into new setting objects sharing the data of the old ones
     Setting::List settings;
-
-    ConnectionSettings *q_ptr;
 };
 
 }
@@ -22,13 +22,20 @@ NetworkManager::GenericSetting::GenericSetting()
 
 NetworkManager::GenericSetting::GenericSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new GenericSettingPrivate())
+    , d_ptr(other->d_ptr)
+{
+}
+
+NetworkManager::GenericSetting::~GenericSetting() = default;
+
+NetworkManager::GenericSettingPrivate *NetworkManager::GenericSetting::d_func()
 {
+    return d_ptr.data();
 }
 
-NetworkManager::GenericSetting::~GenericSetting()
+const NetworkManager::GenericSettingPrivate *NetworkManager::GenericSetting::d_func() const
 {
-    delete d_ptr;
+    return d_ptr.constData();
 }
 
 QString NetworkManager::GenericSetting::name() const
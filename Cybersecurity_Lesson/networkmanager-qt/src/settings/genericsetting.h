@@ -35,10 +35,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    GenericSettingPrivate *d_ptr;
+    QSharedDataPointer<GenericSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(GenericSetting)
+    GenericSettingPrivate *d_func();
+    const GenericSettingPrivate *d_func() const;
+    friend class GenericSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const GenericSetting &setting);
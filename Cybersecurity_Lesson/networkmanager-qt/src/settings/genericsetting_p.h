@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_GENERIC_SETTING_P_H
 #define NETWORKMANAGERQT_GENERIC_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class GenericSettingPrivate
+class GenericSettingPrivate : public QSharedData
 {
 public:
     GenericSettingPrivate();
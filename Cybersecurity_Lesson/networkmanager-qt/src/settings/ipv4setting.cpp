@@ -36,32 +36,22 @@ NetworkManager::Ipv4Setting::Ipv4Setting()
 
 NetworkManager::Ipv4Setting::Ipv4Setting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new Ipv4SettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setMethod(other->method());
-    setDns(other->dns());
-    setDnsSearch(other->dnsSearch());
-    setAddresses(other->addresses());
-    setRoutes(other->routes());
-    setRouteMetric(other->routeMetric());
-    setIgnoreAutoRoutes(other->ignoreAutoRoutes());
-    setIgnoreAutoDns(other->ignoreAutoDns());
-    setDhcpClientId(other->dhcpClientId());
-    setDhcpSendHostname(other->dhcpSendHostname());
-    setDhcpHostname(other->dhcpHostname());
-    setNeverDefault(other->neverDefault());
-    setMayFail(other->mayFail());
-    setDadTimeout(other->dadTimeout());
-    setDhcpFqdn(other->dhcpFqdn());
-    setDnsOptions(other->dnsOptions());
-    setDnsPriority(other->dnsPriority());
-    setAddressData(other->addressData());
-    setRouteData(other->routeData());
 }
 
 NetworkManager::Ipv4Setting::~Ipv4Setting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::Ipv4SettingPrivate *NetworkManager::Ipv4Setting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::Ipv4SettingPrivate *NetworkManager::Ipv4Setting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::Ipv4Setting::name() const
@@ -117,13 +107,36 @@ void NetworkManager::Ipv4Setting::setAddresses(const QList<IpAddress> &ipv4addre
 {
     Q_D(Ipv4Setting);
 
-    d->addresses = ipv4addresses;
+    d->addresses.clear();
+    d->addresses.reserve(ipv4addresses.size());
+    for (const IpAddress &item : ipv4addresses) {
+        d->addresses << item.toCompact();
+    }
 }
 
 QList<NetworkManager::IpAddress> NetworkManager::Ipv4Setting::addresses() const
 {
     Q_D(const Ipv4Setting);
 
+    QList<NetworkManager::IpAddress> result;
+    result.reserve(d->addresses.size());
+    for (const CompactIpAddress &item : d->addresses) {
+        result << IpAddress(item);
+    }
+    return result;
+}
+
+void NetworkManager::Ipv4Setting::setCompactAddresses(const QList<NetworkManager::CompactIpAddress> &addresses)
+{
+    Q_D(Ipv4Setting);
+
+    d->addresses = addresses;
+}
+
+QList<NetworkManager::CompactIpAddress> NetworkManager::Ipv4Setting::compactAddresses() const
+{
+    Q_D(const Ipv4Setting);
+
     return d->addresses;
 }
 
@@ -131,13 +144,36 @@ void NetworkManager::Ipv4Setting::setRoutes(const QList<IpRoute> &ipv4routes)
 {
     Q_D(Ipv4Setting);
 
-    d->routes = ipv4routes;
+    d->routes.clear();
+    d->routes.reserve(ipv4routes.size());
+    for (const IpRoute &item : ipv4routes) {
+        d->routes << item.toCompact();
+    }
 }
 
 QList<NetworkManager::IpRoute> NetworkManager::Ipv4Setting::routes() const
 {
     Q_D(const Ipv4Setting);
 
+    QList<NetworkManager::IpRoute> result;
+    result.reserve(d->routes.size());
+    for (const CompactIpRoute &item : d->routes) {
+        result << IpRoute(item);
+    }
+    return result;
+}
+
+void NetworkManager::Ipv4Setting::setCompactRoutes(const QList<NetworkManager::CompactIpRoute> &routes)
+{
+    Q_D(Ipv4Setting);
+
+    d->routes = routes;
+}
+
+QList<NetworkManager::CompactIpRoute> NetworkManager::Ipv4Setting::compactRoutes() const
+{
+    Q_D(const Ipv4Setting);
+
     return d->routes;
 }
 
@@ -394,7 +430,7 @@ void NetworkManager::Ipv4Setting::fromMap(const QVariantMap &setting)
     }
 
     if (setting.contains(QLatin1String(NMQT_SETTING_IP4_CONFIG_ADDRESSES))) {
-        QList<NetworkManager::IpAddress> addresses;
+        QList<NetworkManager::CompactIpAddress> addresses;
         QList<QList<uint>> temp;
         if (setting.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ADDRESSES)).canConvert<QDBusArgument>()) {
             QDBusArgument addressArg = setting.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ADDRESSES)).value<QDBusArgument>();
@@ -403,27 +439,28 @@ void NetworkManager::Ipv4Setting::fromMap(const QVariantMap &setting)
             temp = setting.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ADDRESSES)).value<QList<QList<uint>>>();
         }
 
+        addresses.reserve(temp.size());
         for (const QList<uint> &uintList : std::as_const(temp)) {
-            if (uintList.count() != 3) {
+            if (uintList.count() != 3 || uintList.at(1) > 32) {
                 continue;
             }
 
-            NetworkManager::IpAddress address;
-            address.setIp(QHostAddress(ntohl(uintList.at(0))));
-            address.setPrefixLength(uintList.at(1));
-            address.setGateway(QHostAddress(ntohl(uintList.at(2))));
-            if (!address.isValid()) {
+            NetworkManager::CompactIpAddress address;
+            address.address = CompactIp::fromIPv4(ntohl(uintList.at(0)));
+            address.prefixLength = uintList.at(1);
+            address.gateway = CompactIp::fromIPv4(ntohl(uintList.at(2)));
+            if (!address.address.isValid()) {
                 continue;
             }
 
             addresses << address;
         }
 
-        setAddresses(addresses);
+        setCompactAddresses(addresses);
     }
 
     if (setting.contains(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTES))) {
-        QList<NetworkManager::IpRoute> routes;
+        QList<NetworkManager::CompactIpRoute> routes;
         QList<QList<uint>> temp;
         if (setting.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTES)).canConvert<QDBusArgument>()) {
             QDBusArgument routeArg = setting.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTES)).value<QDBusArgument>();
@@ -432,24 +469,26 @@ void NetworkManager::Ipv4Setting::fromMap(const QVariantMap &setting)
             temp = setting.value(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTES)).value<QList<QList<uint>>>();
         }
 
+        routes.reserve(temp.size());
         for (const QList<uint> &uintList : std::as_const(temp)) {
-            if (uintList.count() != 4) {
+            if (uintList.count() != 4 || uintList.at(1) > 32) {
                 continue;
             }
 
-            NetworkManager::IpRoute route;
-            route.setIp(QHostAddress(ntohl(uintList.at(0))));
-            route.setPrefixLength(uintList.at(1));
-            route.setNextHop(QHostAddress(ntohl(uintList.at(2))));
-            route.setMetric((quint32)uintList.at(3));
-            if (!route.isValid()) {
+            NetworkManager::CompactIpRoute route;
+            route.destination = CompactIp::fromIPv4(ntohl(uintList.at(0)));
+            route.prefixLength = uintList.at(1);
+            route.nextHop = CompactIp::fromIPv4(ntohl(uintList.at(2)));
+            route.metric = uintList.at(3);
+            if (!route.destination.isValid()) {
                 continue;
             }
+
             routes << route;
         }
 
         if (!routes.isEmpty()) {
-            setRoutes(routes);
+            setCompactRoutes(routes);
         }
     }
 
@@ -544,25 +583,23 @@ QVariantMap NetworkManager::Ipv4Setting::toMap() const
         setting.insert(QLatin1String(NMQT_SETTING_IP4_CONFIG_DNS_SEARCH), dnsSearch());
     }
 
-    if (!addresses().isEmpty()) {
+    if (!compactAddresses().isEmpty()) {
         QList<QList<uint>> dbusAddresses;
-        const auto addressesList = addresses();
-        for (const NetworkManager::IpAddress &addr : addressesList) {
-            QList<uint> dbusAddress;
-            dbusAddress << htonl(addr.ip().toIPv4Address()) << addr.prefixLength() << htonl(addr.gateway().toIPv4Address());
-            dbusAddresses << dbusAddress;
+        const auto addressesList = compactAddresses();
+        dbusAddresses.reserve(addressesList.size());
+        for (const NetworkManager::CompactIpAddress &addr : addressesList) {
+            dbusAddresses << QList<uint>{htonl(addr.address.toIPv4()), addr.prefixLength, htonl(addr.gateway.toIPv4())};
         }
 
         setting.insert(QLatin1String(NMQT_SETTING_IP4_CONFIG_ADDRESSES), QVariant::fromValue(dbusAddresses));
     }
 
-    if (!routes().isEmpty()) {
+    if (!compactRoutes().isEmpty()) {
         QList<QList<uint>> dbusRoutes;
-        const auto routesList = routes();
-        for (const NetworkManager::IpRoute &route : routesList) {
-            QList<uint> dbusRoute;
-            dbusRoute << htonl(route.ip().toIPv4Address()) << route.prefixLength() << htonl(route.nextHop().toIPv4Address()) << route.metric();
-            dbusRoutes << dbusRoute;
+        const auto routesList = compactRoutes();
+        dbusRoutes.reserve(routesList.size());
+        for (const NetworkManager::CompactIpRoute &route : routesList) {
+            dbusRoutes << QList<uint>{htonl(route.destination.toIPv4()), route.prefixLength, htonl(route.nextHop.toIPv4()), route.metric};
         }
 
         setting.insert(QLatin1String(NMQT_SETTING_IP4_CONFIG_ROUTES), QVariant::fromValue(dbusRoutes));
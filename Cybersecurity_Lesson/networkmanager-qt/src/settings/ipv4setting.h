@@ -83,6 +83,20 @@ public:
     void setRoutes(const QList<NetworkManager::IpRoute> &ipv4routes);
     QList<NetworkManager::IpRoute> routes() const;
 
+    /**
+     * Addresses and routes in their compact form, converting them from and to
+     * IpAddress and IpRoute is avoided, which matters for large route tables.
+     * @since 5.94.0
+     */
+    void setCompactAddresses(const QList<NetworkManager::CompactIpAddress> &addresses);
+    QList<NetworkManager::CompactIpAddress> compactAddresses() const;
+
+    /**
+     * @since 5.94.0
+     */
+    void setCompactRoutes(const QList<NetworkManager::CompactIpRoute> &routes);
+    QList<NetworkManager::CompactIpRoute> compactRoutes() const;
+
     void setRouteMetric(int metric);
     int routeMetric() const;
 
@@ -133,10 +147,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    Ipv4SettingPrivate *d_ptr;
+    QSharedDataPointer<Ipv4SettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(Ipv4Setting)
+    Ipv4SettingPrivate *d_func();
+    const Ipv4SettingPrivate *d_func() const;
+    friend class Ipv4SettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const Ipv4Setting &setting);
@@ -7,6 +7,7 @@
 #ifndef NETWORKMANAGERQT_IPV4_SETTING_P_H
 #define NETWORKMANAGERQT_IPV4_SETTING_P_H
 
+#include <QSharedData>
 #include "../ipconfig.h"
 
 #include <QStringList>
@@ -15,7 +16,7 @@
 
 namespace NetworkManager
 {
-class Ipv4SettingPrivate
+class Ipv4SettingPrivate : public QSharedData
 {
 public:
     Ipv4SettingPrivate();
@@ -24,8 +25,8 @@ public:
     NetworkManager::Ipv4Setting::ConfigMethod method;
     QList<QHostAddress> dns;
     QStringList dnsSearch;
-    QList<NetworkManager::IpAddress> addresses;
-    QList<NetworkManager::IpRoute> routes;
+    QList<NetworkManager::CompactIpAddress> addresses;
+    QList<NetworkManager::CompactIpRoute> routes;
     int routeMetric;
     bool ignoreAutoRoutes;
     bool ignoreAutoDns;
@@ -14,6 +14,17 @@
 
 #include <arpa/inet.h>
 
+namespace
+{
+QByteArray ipv6Bytes(const NetworkManager::CompactIp &ip)
+{
+    if (ip.family == NetworkManager::CompactIp::IPv6) {
+        return QByteArray(reinterpret_cast<const char *>(ip.bytes), 16);
+    }
+    return NetworkManager::ipv6AddressFromHostAddress(ip.toHostAddress());
+}
+}
+
 NetworkManager::Ipv6SettingPrivate::Ipv6SettingPrivate()
     : name(NMQT_SETTING_IP6_CONFIG_SETTING_NAME)
     , method(NetworkManager::Ipv6Setting::Automatic)
@@ -38,33 +49,22 @@ NetworkManager::Ipv6Setting::Ipv6Setting()
 
 NetworkManager::Ipv6Setting::Ipv6Setting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new Ipv6SettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setMethod(other->method());
-    setDns(other->dns());
-    setDnsSearch(other->dnsSearch());
-    setAddresses(other->addresses());
-    setRoutes(other->routes());
-    setRouteMetric(other->routeMetric());
-    setIgnoreAutoRoutes(other->ignoreAutoRoutes());
-    setIgnoreAutoDns(other->ignoreAutoDns());
-    setNeverDefault(other->neverDefault());
-    setMayFail(other->mayFail());
-    setDadTimeout(other->dadTimeout());
-    setAddressGenMode(other->addressGenMode());
-    setDhcpTimeout(other->dhcpTimeout());
-    setDhcpHostname(other->dhcpHostname());
-    setDhcpDuid(other->dhcpDuid());
-    setToken(other->token());
-    setDnsOptions(other->dnsOptions());
-    setAddressData(other->addressData());
-    setRouteData(other->routeData());
-    setRouteTable(other->routeTable());
 }
 
 NetworkManager::Ipv6Setting::~Ipv6Setting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::Ipv6SettingPrivate *NetworkManager::Ipv6Setting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::Ipv6SettingPrivate *NetworkManager::Ipv6Setting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::Ipv6Setting::name() const
@@ -120,13 +120,36 @@ void NetworkManager::Ipv6Setting::setAddresses(const QList<IpAddress> ipv6addres
 {
     Q_D(Ipv6Setting);
 
-    d->addresses = ipv6addresses;
+    d->addresses.clear();
+    d->addresses.reserve(ipv6addresses.size());
+    for (const IpAddress &item : ipv6addresses) {
+        d->addresses << item.toCompact();
+    }
 }
 
 QList<NetworkManager::IpAddress> NetworkManager::Ipv6Setting::addresses() const
 {
     Q_D(const Ipv6Setting);
 
+    QList<NetworkManager::IpAddress> result;
+    result.reserve(d->addresses.size());
+    for (const CompactIpAddress &item : d->addresses) {
+        result << IpAddress(item);
+    }
+    return result;
+}
+
+void NetworkManager::Ipv6Setting::setCompactAddresses(const QList<NetworkManager::CompactIpAddress> &addresses)
+{
+    Q_D(Ipv6Setting);
+
+    d->addresses = addresses;
+}
+
+QList<NetworkManager::CompactIpAddress> NetworkManager::Ipv6Setting::compactAddresses() const
+{
+    Q_D(const Ipv6Setting);
+
     return d->addresses;
 }
 
@@ -134,13 +157,36 @@ void NetworkManager::Ipv6Setting::setRoutes(const QList<NetworkManager::IpRoute>
 {
     Q_D(Ipv6Setting);
 
-    d->routes = ipv6routes;
+    d->routes.clear();
+    d->routes.reserve(ipv6routes.size());
+    for (const IpRoute &item : ipv6routes) {
+        d->routes << item.toCompact();
+    }
 }
 
 QList<NetworkManager::IpRoute> NetworkManager::Ipv6Setting::routes() const
 {
     Q_D(const Ipv6Setting);
 
+    QList<NetworkManager::IpRoute> result;
+    result.reserve(d->routes.size());
+    for (const CompactIpRoute &item : d->routes) {
+        result << IpRoute(item);
+    }
+    return result;
+}
+
+void NetworkManager::Ipv6Setting::setCompactRoutes(const QList<NetworkManager::CompactIpRoute> &routes)
+{
+    Q_D(Ipv6Setting);
+
+    d->routes = routes;
+}
+
+QList<NetworkManager::CompactIpRoute> NetworkManager::Ipv6Setting::compactRoutes() const
+{
+    Q_D(const Ipv6Setting);
+
     return d->routes;
 }
 
@@ -419,25 +465,26 @@ void NetworkManager::Ipv6Setting::fromMap(const QVariantMap &setting)
         } else {
             temp = setting.value(QLatin1String(NMQT_SETTING_IP6_CONFIG_ADDRESSES)).value<QList<IpV6DBusAddress>>();
         }
-        QList<NetworkManager::IpAddress> addresses;
+        QList<NetworkManager::CompactIpAddress> addresses;
+        addresses.reserve(temp.size());
 
         for (const IpV6DBusAddress &addressMap : std::as_const(temp)) {
-            if (addressMap.address.isEmpty() || !addressMap.prefix || addressMap.gateway.isEmpty()) {
+            if (addressMap.address.size() != 16 || !addressMap.prefix || addressMap.prefix > 128 || addressMap.gateway.size() != 16) {
                 continue;
             }
 
-            NetworkManager::IpAddress address;
-            address.setIp(ipv6AddressAsHostAddress(addressMap.address));
-            address.setPrefixLength(addressMap.prefix);
-            address.setGateway(ipv6AddressAsHostAddress(addressMap.gateway));
-            if (!address.isValid()) {
+            NetworkManager::CompactIpAddress address;
+            address.address = CompactIp::fromIPv6(reinterpret_cast<const quint8 *>(addressMap.address.constData()));
+            address.prefixLength = addressMap.prefix;
+            address.gateway = CompactIp::fromIPv6(reinterpret_cast<const quint8 *>(addressMap.gateway.constData()));
+            if (!address.address.isValid()) {
                 continue;
             }
 
             addresses << address;
         }
 
-        setAddresses(addresses);
+        setCompactAddresses(addresses);
     }
 
     if (setting.contains(QLatin1String(NMQT_SETTING_IP6_CONFIG_ROUTES))) {
@@ -448,25 +495,26 @@ void NetworkManager::Ipv6Setting::fromMap(const QVariantMap &setting)
         } else {
             temp = setting.value(QLatin1String(NMQT_SETTING_IP6_CONFIG_ROUTES)).value<QList<IpV6DBusRoute>>();
         }
-        QList<NetworkManager::IpRoute> routes;
+        QList<NetworkManager::CompactIpRoute> routes;
+        routes.reserve(temp.size());
 
         for (const IpV6DBusRoute &routeMap : std::as_const(temp)) {
-            if (routeMap.destination.isEmpty() || !routeMap.prefix || routeMap.nexthop.isEmpty() || !routeMap.metric) {
+            if (routeMap.destination.size() != 16 || !routeMap.prefix || routeMap.prefix > 128 || routeMap.nexthop.size() != 16 || !routeMap.metric) {
                 continue;
             }
 
-            NetworkManager::IpRoute route;
-            route.setIp(ipv6AddressAsHostAddress(routeMap.destination));
-            route.setPrefixLength(routeMap.prefix);
-            route.setNextHop(ipv6AddressAsHostAddress(routeMap.nexthop));
-            route.setMetric(routeMap.metric);
-            if (!route.isValid()) {
+            NetworkManager::CompactIpRoute route;
+            route.destination = CompactIp::fromIPv6(reinterpret_cast<const quint8 *>(routeMap.destination.constData()));
+            route.prefixLength = routeMap.prefix;
+            route.nextHop = CompactIp::fromIPv6(reinterpret_cast<const quint8 *>(routeMap.nexthop.constData()));
+            route.metric = routeMap.metric;
+            if (!route.destination.isValid()) {
                 continue;
             }
 
             routes << route;
         }
-        setRoutes(routes);
+        setCompactRoutes(routes);
     }
 
     if (setting.contains(QLatin1String(NMQT_SETTING_IP6_CONFIG_ROUTE_METRIC))) {
@@ -565,29 +613,31 @@ QVariantMap NetworkManager::Ipv6Setting::toMap() const
         setting.insert(QLatin1String(NMQT_SETTING_IP6_CONFIG_DNS_SEARCH), dnsSearch());
     }
 
-    if (!addresses().isEmpty()) {
+    if (!compactAddresses().isEmpty()) {
         QList<IpV6DBusAddress> dbusAddresses;
-        const QList<NetworkManager::IpAddress> addressesList = addresses();
-        for (const NetworkManager::IpAddress &addr : addressesList) {
+        const QList<NetworkManager::CompactIpAddress> addressesList = compactAddresses();
+        dbusAddresses.reserve(addressesList.size());
+        for (const NetworkManager::CompactIpAddress &addr : addressesList) {
             IpV6DBusAddress dbusAddress;
-            dbusAddress.address = ipv6AddressFromHostAddress(addr.ip());
-            dbusAddress.prefix = addr.prefixLength();
-            dbusAddress.gateway = ipv6AddressFromHostAddress(addr.gateway());
+            dbusAddress.address = ipv6Bytes(addr.address);
+            dbusAddress.prefix = addr.prefixLength;
+            dbusAddress.gateway = ipv6Bytes(addr.gateway);
             dbusAddresses << dbusAddress;
         }
 
         setting.insert(QLatin1String(NMQT_SETTING_IP6_CONFIG_ADDRESSES), QVariant::fromValue(dbusAddresses));
     }
 
-    if (!routes().isEmpty()) {
+    if (!compactRoutes().isEmpty()) {
         QList<IpV6DBusRoute> dbusRoutes;
-        const QList<NetworkManager::IpRoute> routesList = routes();
-        for (const NetworkManager::IpRoute &route : routesList) {
+        const QList<NetworkManager::CompactIpRoute> routesList = compactRoutes();
+        dbusRoutes.reserve(routesList.size());
+        for (const NetworkManager::CompactIpRoute &route : routesList) {
             IpV6DBusRoute dbusRoute;
-            dbusRoute.destination = ipv6AddressFromHostAddress(route.ip());
-            dbusRoute.prefix = route.prefixLength();
-            dbusRoute.nexthop = ipv6AddressFromHostAddress(route.nextHop());
-            dbusRoute.metric = route.metric();
+            dbusRoute.destination = ipv6Bytes(route.destination);
+            dbusRoute.prefix = route.prefixLength;
+            dbusRoute.nexthop = ipv6Bytes(route.nextHop);
+            dbusRoute.metric = route.metric;
             dbusRoutes << dbusRoute;
         }
 
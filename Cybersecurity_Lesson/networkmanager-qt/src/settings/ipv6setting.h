@@ -112,6 +112,20 @@ public:
     void setRoutes(const QList<NetworkManager::IpRoute> ipv6routes);
     QList<NetworkManager::IpRoute> routes() const;
 
+    /**
+     * Addresses and routes in their compact form, converting them from and to
+     * IpAddress and IpRoute is avoided, which matters for large route tables.
+     * @since 5.94.0
+     */
+    void setCompactAddresses(const QList<NetworkManager::CompactIpAddress> &addresses);
+    QList<NetworkManager::CompactIpAddress> compactAddresses() const;
+
+    /**
+     * @since 5.94.0
+     */
+    void setCompactRoutes(const QList<NetworkManager::CompactIpRoute> &routes);
+    QList<NetworkManager::CompactIpRoute> compactRoutes() const;
+
     void setRouteMetric(int metric);
     int routeMetric() const;
 
@@ -165,10 +179,12 @@ public:
     quint32 routeTable() const;
 
 protected:
-    Ipv6SettingPrivate *const d_ptr;
+    QSharedDataPointer<Ipv6SettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(Ipv6Setting)
+    Ipv6SettingPrivate *d_func();
+    const Ipv6SettingPrivate *d_func() const;
+    friend class Ipv6SettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const Ipv6Setting &setting);
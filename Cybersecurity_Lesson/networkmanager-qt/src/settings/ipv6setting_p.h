@@ -7,6 +7,7 @@
 #ifndef NETWORKMANAGERQT_IPV6_SETTING_P_H
 #define NETWORKMANAGERQT_IPV6_SETTING_P_H
 
+#include <QSharedData>
 #include "../ipconfig.h"
 
 #include <QStringList>
@@ -14,7 +15,7 @@
 
 namespace NetworkManager
 {
-class Ipv6SettingPrivate
+class Ipv6SettingPrivate : public QSharedData
 {
 public:
     Ipv6SettingPrivate();
@@ -23,8 +24,8 @@ public:
     NetworkManager::Ipv6Setting::ConfigMethod method;
     QList<QHostAddress> dns;
     QStringList dnsSearch;
-    QList<NetworkManager::IpAddress> addresses;
-    QList<NetworkManager::IpRoute> routes;
+    QList<NetworkManager::CompactIpAddress> addresses;
+    QList<NetworkManager::CompactIpRoute> routes;
     int routeMetric;
     bool ignoreAutoRoutes;
     bool ignoreAutoDns;
@@ -44,22 +44,22 @@ NetworkManager::MacsecSetting::MacsecSetting()
 
 NetworkManager::MacsecSetting::MacsecSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new MacsecSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setEncrypt(other->encrypt());
-    setMkaCak(other->mkaCak());
-    setMkaCkn(other->mkaCkn());
-    setMode(other->mode());
-    setParent(other->parent());
-    setPort(other->port());
-    setSendSci(other->sendSci());
-    setValidation(other->validation());
-    setMkaCakFlags(other->mkaCakFlags());
 }
 
 NetworkManager::MacsecSetting::~MacsecSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::MacsecSettingPrivate *NetworkManager::MacsecSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::MacsecSettingPrivate *NetworkManager::MacsecSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::MacsecSetting::name() const
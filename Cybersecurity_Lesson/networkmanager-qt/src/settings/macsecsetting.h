@@ -78,10 +78,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    MacsecSettingPrivate *d_ptr;
+    QSharedDataPointer<MacsecSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(MacsecSetting)
+    MacsecSettingPrivate *d_func();
+    const MacsecSettingPrivate *d_func() const;
+    friend class MacsecSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const MacsecSetting &setting);
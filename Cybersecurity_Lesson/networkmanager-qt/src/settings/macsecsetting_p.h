@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_MACSECSETTING_P_H
 #define NETWORKMANAGERQT_MACSECSETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class MacsecSettingPrivate
+class MacsecSettingPrivate : public QSharedData
 {
 public:
     MacsecSettingPrivate();
@@ -14,6 +14,10 @@
 #define NM_SETTING_MATCH_INTERFACE_NAME "interface-name"
 #endif
 
+#if !NM_CHECK_VERSION(1, 26, 0)
+#define NM_SETTING_MATCH_DRIVER "driver"
+#endif
+
 NetworkManager::MatchSettingPrivate::MatchSettingPrivate()
     : name(NM_SETTING_MATCH_SETTING_NAME)
 {
@@ -27,14 +31,22 @@ NetworkManager::MatchSetting::MatchSetting()
 
 NetworkManager::MatchSetting::MatchSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new MatchSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setInterfaceName(other->interfaceName());
 }
 
 NetworkManager::MatchSetting::~MatchSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::MatchSettingPrivate *NetworkManager::MatchSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::MatchSettingPrivate *NetworkManager::MatchSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::MatchSetting::name() const
@@ -58,11 +70,29 @@ QStringList NetworkManager::MatchSetting::interfaceName() const
     return d->interfaceName;
 }
 
+void NetworkManager::MatchSetting::setDriver(const QStringList &driver)
+{
+    Q_D(MatchSetting);
+
+    d->driver = driver;
+}
+
+QStringList NetworkManager::MatchSetting::driver() const
+{
+    Q_D(const MatchSetting);
+
+    return d->driver;
+}
+
 void NetworkManager::MatchSetting::fromMap(const QVariantMap &setting)
 {
     if (setting.contains(QLatin1String(NM_SETTING_MATCH_INTERFACE_NAME))) {
         setInterfaceName(setting.value(QLatin1String(NM_SETTING_MATCH_INTERFACE_NAME)).toStringList());
     }
+
+    if (setting.contains(QLatin1String(NM_SETTING_MATCH_DRIVER))) {
+        setDriver(setting.value(QLatin1String(NM_SETTING_MATCH_DRIVER)).toStringList());
+    }
 }
 
 QVariantMap NetworkManager::MatchSetting::toMap() const
@@ -73,6 +103,10 @@ QVariantMap NetworkManager::MatchSetting::toMap() const
         setting.insert(QLatin1String(NM_SETTING_MATCH_INTERFACE_NAME), interfaceName());
     }
 
+    if (!driver().isEmpty()) {
+        setting.insert(QLatin1String(NM_SETTING_MATCH_DRIVER), driver());
+    }
+
     return setting;
 }
 
@@ -82,6 +116,7 @@ QDebug NetworkManager::operator<<(QDebug dbg, const NetworkManager::MatchSetting
     dbg.nospace() << "initialized: " << !setting.isNull() << '\n';
 
     dbg.nospace() << NM_SETTING_MATCH_INTERFACE_NAME << ": " << setting.interfaceName() << '\n';
+    dbg.nospace() << NM_SETTING_MATCH_DRIVER << ": " << setting.driver() << '\n';
 
     return dbg.maybeSpace();
 }
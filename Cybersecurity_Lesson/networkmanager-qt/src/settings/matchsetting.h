@@ -32,15 +32,25 @@ public:
     void setInterfaceName(const QStringList &name);
     QStringList interfaceName() const;
 
+    /**
+     * Shell wildcard patterns the driver of the device is matched against,
+     * with the same syntax as interfaceName()
+     * @since 5.94.0
+     */
+    void setDriver(const QStringList &driver);
+    QStringList driver() const;
+
     void fromMap(const QVariantMap &setting) override;
 
     QVariantMap toMap() const override;
 
 protected:
-    MatchSettingPrivate *d_ptr;
+    QSharedDataPointer<MatchSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(MatchSetting)
+    MatchSettingPrivate *d_func();
+    const MatchSettingPrivate *d_func() const;
+    friend class MatchSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const MatchSetting &setting);
@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_MATCH_SETTING_P_H
 #define NETWORKMANAGERQT_MATCH_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class MatchSettingPrivate
+class MatchSettingPrivate : public QSharedData
 {
 public:
     MatchSettingPrivate();
@@ -19,6 +20,7 @@ public:
     QString name;
 
     QStringList interfaceName;
+    QStringList driver;
 };
 
 }
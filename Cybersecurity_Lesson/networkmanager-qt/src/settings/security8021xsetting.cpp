@@ -8,6 +8,58 @@
 #include "security8021xsetting_p.h"
 
 #include <QDebug>
+#include <QMutex>
+#include <QSet>
+
+namespace
+{
+// Content addressed store for certificate blobs, so that the same certificate used
+// by many profiles (e.g. the CA chain of eduroam) is held in memory only once
+class CertificateStore
+{
+public:
+    QByteArray intern(const QByteArray &certificate)
+    {
+        if (certificate.isEmpty()) {
+            return certificate;
+        }
+
+        QMutexLocker locker(&m_mutex);
+        const auto it = m_certificates.constFind(certificate);
+        if (it != m_certificates.constEnd()) {
+            return *it;
+        }
+
+        if (m_certificates.size() >= m_pruneThreshold) {
+            prune();
+        }
+        // deep copy, the argument may wrap memory we don't own
+        const QByteArray copy(certificate.constData(), certificate.size());
+        m_certificates.insert(copy);
+        return copy;
+    }
+
+private:
+    // drops the certificates no setting refers to anymore
+    void prune()
+    {
+        for (auto it = m_certificates.begin(); it != m_certificates.end();) {
+            if (it->isDetached()) {
+                it = m_certificates.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        m_pruneThreshold = qMax<qsizetype>(64, m_certificates.size() * 2);
+    }
+
+    QMutex m_mutex;
+    QSet<QByteArray> m_certificates;
+    qsizetype m_pruneThreshold = 64;
+};
+
+Q_GLOBAL_STATIC(CertificateStore, certificateStore)
+}
 
 NetworkManager::Security8021xSettingPrivate::Security8021xSettingPrivate()
     : name(NM_SETTING_802_1X_SETTING_NAME)
@@ -33,43 +85,22 @@ NetworkManager::Security8021xSetting::Security8021xSetting()
 
 NetworkManager::Security8021xSetting::Security8021xSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new Security8021xSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setEapMethods(other->eapMethods());
-    setIdentity(other->identity());
-    setDomainSuffixMatch(other->domainSuffixMatch());
-    setAnonymousIdentity(other->anonymousIdentity());
-    setPacFile(other->pacFile());
-    setCaCertificate(other->caCertificate());
-    setCaPath(other->caPath());
-    setSubjectMatch(other->subjectMatch());
-    setAltSubjectMatches(other->altSubjectMatches());
-    setClientCertificate(other->clientCertificate());
-    setPhase1PeapVersion(other->phase1PeapVersion());
-    setPhase1PeapLabel(other->phase1PeapLabel());
-    setPhase1FastProvisioning(other->phase1FastProvisioning());
-    setPhase2AuthMethod(other->phase2AuthMethod());
-    setPhase2AuthEapMethod(other->phase2AuthEapMethod());
-    setPhase2CaCertificate(other->phase2CaCertificate());
-    setPhase2CaPath(other->phase2CaPath());
-    setPhase2SubjectMatch(other->phase2SubjectMatch());
-    setPhase2AltSubjectMatches(other->phase2AltSubjectMatches());
-    setPassword(other->password());
-    setPasswordFlags(other->passwordFlags());
-    setPasswordRaw(other->passwordRaw());
-    setPasswordRawFlags(other->passwordRawFlags());
-    setPrivateKey(other->privateKey());
-    setPrivateKeyPassword(other->privateKeyPassword());
-    setPrivateKeyPasswordFlags(other->privateKeyPasswordFlags());
-    setPhase2PrivateKey(other->phase2PrivateKey());
-    setPhase2PrivateKeyPassword(other->phase2PrivateKeyPassword());
-    setPhase2PrivateKeyPasswordFlags(other->phase2PrivateKeyPasswordFlags());
-    setSystemCaCertificates(other->systemCaCertificates());
 }
 
 NetworkManager::Security8021xSetting::~Security8021xSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::Security8021xSettingPrivate *NetworkManager::Security8021xSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::Security8021xSettingPrivate *NetworkManager::Security8021xSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::Security8021xSetting::name() const
@@ -153,7 +184,7 @@ void NetworkManager::Security8021xSetting::setCaCertificate(const QByteArray &ce
 {
     Q_D(Security8021xSetting);
 
-    d->caCert = certificate;
+    d->caCert = certificateStore->intern(certificate);
 }
 
 QByteArray NetworkManager::Security8021xSetting::caCertificate() const
@@ -209,7 +240,7 @@ void NetworkManager::Security8021xSetting::setClientCertificate(const QByteArray
 {
     Q_D(Security8021xSetting);
 
-    d->clientCert = certificate;
+    d->clientCert = certificateStore->intern(certificate);
 }
 
 QByteArray NetworkManager::Security8021xSetting::clientCertificate() const
@@ -293,7 +324,7 @@ void NetworkManager::Security8021xSetting::setPhase2CaCertificate(const QByteArr
 {
     Q_D(Security8021xSetting);
 
-    d->phase2CaCert = certificate;
+    d->phase2CaCert = certificateStore->intern(certificate);
 }
 
 QByteArray NetworkManager::Security8021xSetting::phase2CaCertificate() const
@@ -349,7 +380,7 @@ void NetworkManager::Security8021xSetting::setPhase2ClientCertificate(const QByt
 {
     Q_D(Security8021xSetting);
 
-    d->phase2ClientCert = certificate;
+    d->phase2ClientCert = certificateStore->intern(certificate);
 }
 
 QByteArray NetworkManager::Security8021xSetting::phase2ClientCertificate() const
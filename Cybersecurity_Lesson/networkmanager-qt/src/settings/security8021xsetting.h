@@ -101,6 +101,9 @@ public:
      * \param certificate certificate's file path encoded into a byte array.
      *
      * \warning certificate have to be null terminated or NetworkManager will refuse it.
+     *
+     * \note Since 5.94.0 identical certificates set on different settings share
+     * the same data, this applies to all the certificate setters.
      */
     void setCaCertificate(const QByteArray &certificate);
     QByteArray caCertificate() const;
@@ -219,10 +222,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    Security8021xSettingPrivate *const d_ptr;
+    QSharedDataPointer<Security8021xSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(Security8021xSetting)
+    Security8021xSettingPrivate *d_func();
+    const Security8021xSettingPrivate *d_func() const;
+    friend class Security8021xSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const Security8021xSetting &setting);
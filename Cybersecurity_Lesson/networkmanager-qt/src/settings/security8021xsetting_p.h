@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_SECURITY8021X_SETTING_P_H
 #define NETWORKMANAGERQT_SECURITY8021X_SETTING_P_H
 
+#include <QSharedData>
 #include <QStringList>
 
 namespace NetworkManager
 {
-class Security8021xSettingPrivate
+class Security8021xSettingPrivate : public QSharedData
 {
 public:
     Security8021xSettingPrivate();
@@ -11,6 +11,7 @@
 #define signals Q_SIGNALS
 
 #include <QDebug>
+#include <QSharedData>
 
 #if !NM_CHECK_VERSION(1, 16, 0)
 #define NM_SETTING_WIREGUARD_SETTING_NAME "wireguard"
@@ -40,7 +41,7 @@
 
 namespace NetworkManager
 {
-class SettingPrivate
+class SettingPrivate : public QSharedData
 {
 public:
     SettingPrivate();
@@ -157,15 +158,22 @@ NetworkManager::Setting::Setting(SettingType type)
 }
 
 NetworkManager::Setting::Setting(const NetworkManager::Setting::Ptr &setting)
-    : d_ptr(new SettingPrivate())
+    : d_ptr(setting->d_ptr)
 {
-    setInitialized(!setting->isNull());
-    setType(setting->type());
 }
 
 NetworkManager::Setting::~Setting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::SettingPrivate *NetworkManager::Setting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::SettingPrivate *NetworkManager::Setting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 void NetworkManager::Setting::fromMap(const QVariantMap &map)
@@ -15,6 +15,7 @@
 #include <libnm/NetworkManager.h>
 #define signals Q_SIGNALS
 
+#include <QSharedDataPointer>
 #include <QSharedPointer>
 #include <QStringList>
 #include <QVariantMap>
@@ -66,6 +67,10 @@ public:
     static SettingType typeFromString(const QString &type);
 
     explicit Setting(SettingType type);
+    /**
+     * Constructs a copy of @p setting. The data is implicitly shared and
+     * only detached when either setting is modified.
+     */
     explicit Setting(const Ptr &setting);
     virtual ~Setting();
 
@@ -112,10 +117,12 @@ public:
     SettingType type() const;
 
 protected:
-    SettingPrivate *d_ptr;
+    QSharedDataPointer<SettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(Setting)
+    SettingPrivate *d_func();
+    const SettingPrivate *d_func() const;
+    friend class SettingPrivate;
 };
 Q_DECLARE_OPERATORS_FOR_FLAGS(Setting::SecretFlags)
 
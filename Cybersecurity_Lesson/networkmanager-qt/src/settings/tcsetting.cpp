@@ -29,15 +29,22 @@ NetworkManager::TcSetting::TcSetting()
 
 NetworkManager::TcSetting::TcSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new TcSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setQdiscs(other->qdiscs());
-    setTfilters(other->tfilters());
 }
 
 NetworkManager::TcSetting::~TcSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::TcSettingPrivate *NetworkManager::TcSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::TcSettingPrivate *NetworkManager::TcSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::TcSetting::name() const
@@ -40,10 +40,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    TcSettingPrivate *d_ptr;
+    QSharedDataPointer<TcSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(TcSetting)
+    TcSettingPrivate *d_func();
+    const TcSettingPrivate *d_func() const;
+    friend class TcSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const TcSetting &setting);
@@ -7,6 +7,7 @@
 #ifndef NETWORKMANAGERQT_TC_SETTING_P_H
 #define NETWORKMANAGERQT_TC_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 #include <networkmanagerqt/networkmanagerqt_export.h>
@@ -15,7 +16,7 @@ typedef QList<QVariantMap> NMVariantMapList;
 
 namespace NetworkManager
 {
-class TcSettingPrivate
+class TcSettingPrivate : public QSharedData
 {
 public:
     TcSettingPrivate();
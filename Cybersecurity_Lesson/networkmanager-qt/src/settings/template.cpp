@@ -26,17 +26,22 @@ NetworkManager::TemplateSetting::TemplateSetting()
 
 NetworkManager::TemplateSetting::TemplateSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new TemplateSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    /*
-     * setFoo(setting->foo());
-     *
-     */
 }
 
 NetworkManager::TemplateSetting::~TemplateSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::TemplateSettingPrivate *NetworkManager::TemplateSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::TemplateSettingPrivate *NetworkManager::TemplateSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::TemplateSetting::name() const
@@ -35,10 +35,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    TemplateSettingPrivate *d_ptr;
+    QSharedDataPointer<TemplateSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(TemplateSetting)
+    TemplateSettingPrivate *d_func();
+    const TemplateSettingPrivate *d_func() const;
+    friend class TemplateSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const TemplateSetting &setting);
@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_TEMPLATE_SETTING_P_H
 #define NETWORKMANAGERQT_TEMPLATE_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class TemplateSettingPrivate
+class TemplateSettingPrivate : public QSharedData
 {
 public:
     TemplateSettingPrivate();
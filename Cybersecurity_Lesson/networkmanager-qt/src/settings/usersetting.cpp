@@ -27,14 +27,22 @@ NetworkManager::UserSetting::UserSetting()
 
 NetworkManager::UserSetting::UserSetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new UserSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setData(other->data());
 }
 
 NetworkManager::UserSetting::~UserSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::UserSettingPrivate *NetworkManager::UserSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::UserSettingPrivate *NetworkManager::UserSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::UserSetting::name() const
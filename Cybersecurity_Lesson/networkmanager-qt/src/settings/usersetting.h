@@ -40,10 +40,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    UserSettingPrivate *d_ptr;
+    QSharedDataPointer<UserSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(UserSetting)
+    UserSettingPrivate *d_func();
+    const UserSettingPrivate *d_func() const;
+    friend class UserSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const UserSetting &setting);
@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_USER_SETTING_P_H
 #define NETWORKMANAGERQT_USER_SETTING_P_H
 
+#include <QSharedData>
 #include <QString>
 
 namespace NetworkManager
 {
-class UserSettingPrivate
+class UserSettingPrivate : public QSharedData
 {
 public:
     UserSettingPrivate();
@@ -36,28 +36,22 @@ NetworkManager::WiredSetting::WiredSetting()
 
 NetworkManager::WiredSetting::WiredSetting(const WiredSetting::Ptr &other)
     : Setting(other)
-    , d_ptr(new WiredSettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setPort(other->port());
-    setSpeed(other->speed());
-    setDuplexType(other->duplexType());
-    setAutoNegotiate(other->autoNegotiate());
-    setGenerateMacAddressMask(other->generateMacAddressMask());
-    setMacAddress(other->macAddress());
-    setClonedMacAddress(other->clonedMacAddress());
-    setMacAddressBlacklist(other->macAddressBlacklist());
-    setMtu(other->mtu());
-    setS390Subchannels(other->s390Subchannels());
-    setS390NetType(other->s390NetType());
-    setS390Options(other->s390Options());
-    setWakeOnLan(other->wakeOnLan());
-    setWakeOnLanPassword(other->wakeOnLanPassword());
-    setAssignedMacAddress(other->assignedMacAddress());
 }
 
 NetworkManager::WiredSetting::~WiredSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::WiredSettingPrivate *NetworkManager::WiredSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::WiredSettingPrivate *NetworkManager::WiredSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::WiredSetting::name() const
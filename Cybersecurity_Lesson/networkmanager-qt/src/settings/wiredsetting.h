@@ -115,10 +115,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    WiredSettingPrivate *d_ptr;
+    QSharedDataPointer<WiredSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(WiredSetting)
+    WiredSettingPrivate *d_func();
+    const WiredSettingPrivate *d_func() const;
+    friend class WiredSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const WiredSetting &setting);
@@ -7,12 +7,13 @@
 #ifndef NETWORKMANAGERQT_WIRED_SETTING_P_H
 #define NETWORKMANAGERQT_WIRED_SETTING_P_H
 
+#include <QSharedData>
 #include <QMap>
 #include <QStringList>
 
 namespace NetworkManager
 {
-class WiredSettingPrivate
+class WiredSettingPrivate : public QSharedData
 {
 public:
     WiredSettingPrivate();
@@ -34,30 +34,22 @@ NetworkManager::WirelessSecuritySetting::WirelessSecuritySetting()
 
 NetworkManager::WirelessSecuritySetting::WirelessSecuritySetting(const Ptr &other)
     : Setting(other)
-    , d_ptr(new WirelessSecuritySettingPrivate())
+    , d_ptr(other->d_ptr)
 {
-    setKeyMgmt(other->keyMgmt());
-    setWepTxKeyindex(other->wepTxKeyindex());
-    setAuthAlg(other->authAlg());
-    setProto(other->proto());
-    setPairwise(other->pairwise());
-    setGroup(other->group());
-    setWepKey0(other->wepKey0());
-    setWepKey1(other->wepKey1());
-    setWepKey2(other->wepKey2());
-    setWepKey3(other->wepKey3());
-    setWepKeyFlags(other->wepKeyFlags());
-    setWepKeyType(other->wepKeyType());
-    setPsk(other->psk());
-    setPskFlags(other->pskFlags());
-    setLeapPassword(other->leapPassword());
-    setLeapPasswordFlags(other->leapPasswordFlags());
-    setPmf(other->pmf());
 }
 
 NetworkManager::WirelessSecuritySetting::~WirelessSecuritySetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::WirelessSecuritySettingPrivate *NetworkManager::WirelessSecuritySetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::WirelessSecuritySettingPrivate *NetworkManager::WirelessSecuritySetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::WirelessSecuritySetting::name() const
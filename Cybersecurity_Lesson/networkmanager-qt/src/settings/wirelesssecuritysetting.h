@@ -133,10 +133,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    WirelessSecuritySettingPrivate *d_ptr;
+    QSharedDataPointer<WirelessSecuritySettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(WirelessSecuritySetting)
+    WirelessSecuritySettingPrivate *d_func();
+    const WirelessSecuritySettingPrivate *d_func() const;
+    friend class WirelessSecuritySettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const WirelessSecuritySetting &setting);
@@ -7,12 +7,13 @@
 #ifndef NETWORKMANAGERQT_WIRELESSSECURITY_SETTING_P_H
 #define NETWORKMANAGERQT_WIRELESSSECURITY_SETTING_P_H
 
+#include <QSharedData>
 #include <QList>
 #include <QString>
 
 namespace NetworkManager
 {
-class WirelessSecuritySettingPrivate
+class WirelessSecuritySettingPrivate : public QSharedData
 {
 public:
     WirelessSecuritySettingPrivate();
@@ -37,31 +37,22 @@ NetworkManager::WirelessSetting::WirelessSetting()
 
 NetworkManager::WirelessSetting::WirelessSetting(const Ptr &setting)
     : Setting(setting)
-    , d_ptr(new WirelessSettingPrivate)
-{
-    setSsid(setting->ssid());
-    setMode(setting->mode());
-    setBand(setting->band());
-    setChannel(setting->channel());
-    setBssid(setting->bssid());
-    setRate(setting->rate());
-    setTxPower(setting->txPower());
-    setMacAddress(setting->macAddress());
-    setGenerateMacAddressMask(setting->generateMacAddressMask());
-    setClonedMacAddress(setting->clonedMacAddress());
-    setMacAddressBlacklist(setting->macAddressBlacklist());
-    setMacAddressRandomization(setting->macAddressRandomization());
-    setMtu(setting->mtu());
-    setSeenBssids(setting->seenBssids());
-    setPowerSave(setting->powerSave());
-    setSecurity(setting->security());
-    setHidden(setting->hidden());
-    setAssignedMacAddress(setting->assignedMacAddress());
+    , d_ptr(setting->d_ptr)
+{
 }
 
 NetworkManager::WirelessSetting::~WirelessSetting()
 {
-    delete d_ptr;
+}
+
+NetworkManager::WirelessSettingPrivate *NetworkManager::WirelessSetting::d_func()
+{
+    return d_ptr.data();
+}
+
+const NetworkManager::WirelessSettingPrivate *NetworkManager::WirelessSetting::d_func() const
+{
+    return d_ptr.constData();
 }
 
 QString NetworkManager::WirelessSetting::name() const
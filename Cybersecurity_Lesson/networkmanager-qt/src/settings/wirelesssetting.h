@@ -112,10 +112,12 @@ public:
     QVariantMap toMap() const override;
 
 protected:
-    WirelessSettingPrivate *d_ptr;
+    QSharedDataPointer<WirelessSettingPrivate> d_ptr;
 
 private:
-    Q_DECLARE_PRIVATE(WirelessSetting)
+    WirelessSettingPrivate *d_func();
+    const WirelessSettingPrivate *d_func() const;
+    friend class WirelessSettingPrivate;
 };
 
 NETWORKMANAGERQT_EXPORT QDebug operator<<(QDebug dbg, const WirelessSetting &setting);
@@ -7,11 +7,12 @@
 #ifndef NETWORKMANAGERQT_WIRELESS_SETTING_P_H
 #define NETWORKMANAGERQT_WIRELESS_SETTING_P_H
 
+#include <QSharedData>
 #include <QStringList>
 
 namespace NetworkManager
 {
-class WirelessSettingPrivate
+class WirelessSettingPrivate : public QSharedData
 {
 public:
     WirelessSettingPrivate();
@@ -30,6 +30,7 @@ public:
     bool canModify() const;
     QDBusPendingReply<QDBusObjectPath> addConnection(const NMVariantMapMap &);
     QDBusPendingReply<QDBusObjectPath> addConnectionUnsaved(const NMVariantMapMap &);
+    QDBusPendingReply<QDBusObjectPath, QVariantMap> addConnection2(const NMVariantMapMap &, uint flags, const QVariantMap &args);
     QDBusPendingReply<bool, QStringList> loadConnections(const QStringList &filenames);
     void saveHostname(const QString &);
     QDBusPendingReply<bool> reloadConnections();
@@ -25,7 +25,6 @@ NetworkManager::WirelessDevicePrivate::WirelessDevicePrivate(const QString &path
 #else
     , wirelessIface(NetworkManagerPrivate::DBUS_SERVICE, path, QDBusConnection::systemBus())
 #endif
-    , bitRate(0)
 {
 }
 
@@ -118,6 +117,12 @@ int NetworkManager::WirelessDevice::bitRate() const
     return d->bitRate;
 }
 
+QBindable<int> NetworkManager::WirelessDevice::bindableBitRate()
+{
+    Q_D(WirelessDevice);
+    return &d->bitRate;
+}
+
 QDateTime NetworkManager::WirelessDevice::lastScan() const
 {
     Q_D(const WirelessDevice);
@@ -179,6 +184,7 @@ void NetworkManager::WirelessDevicePrivate::accessPointAdded(const QDBusObjectPa
     if (!apMap.contains(accessPoint.path())) {
         NetworkManager::AccessPoint::Ptr accessPointPtr(new NetworkManager::AccessPoint(accessPoint.path()), &QObject::deleteLater);
         apMap.insert(accessPoint.path(), accessPointPtr);
+        NetworkManagerPrivate::journal(JournalEvent::AccessPointAppeared, accessPoint.path(), uni);
         Q_EMIT q->accessPointAppeared(accessPoint.path());
 
         const QString ssid = accessPointPtr->ssid();
@@ -186,6 +192,7 @@ void NetworkManager::WirelessDevicePrivate::accessPointAdded(const QDBusObjectPa
             NetworkManager::WirelessNetwork::Ptr wifiNetwork(new NetworkManager::WirelessNetwork(accessPointPtr, q), &QObject::deleteLater);
             networks.insert(ssid, wifiNetwork);
             connect(wifiNetwork.data(), &WirelessNetwork::disappeared, this, &WirelessDevicePrivate::removeNetwork);
+            NetworkManagerPrivate::journal(JournalEvent::NetworkAppeared, ssid, uni);
             Q_EMIT q->networkAppeared(ssid);
         }
     }
@@ -198,6 +205,7 @@ void NetworkManager::WirelessDevicePrivate::accessPointRemoved(const QDBusObject
     if (!apMap.contains(accessPoint.path())) {
         qCDebug(NMQT) << "Access point list lookup failed for " << accessPoint.path();
     }
+    NetworkManagerPrivate::journal(JournalEvent::AccessPointDisappeared, accessPoint.path(), uni);
     Q_EMIT q->accessPointDisappeared(accessPoint.path());
     apMap.remove(accessPoint.path());
 }
@@ -208,6 +216,7 @@ void NetworkManager::WirelessDevicePrivate::removeNetwork(const QString &network
 
     if (networks.contains(network)) {
         networks.remove(network);
+        NetworkManagerPrivate::journal(JournalEvent::NetworkDisappeared, network, uni);
         Q_EMIT q->networkDisappeared(network);
     }
 }
@@ -227,8 +236,8 @@ void NetworkManager::WirelessDevicePrivate::propertyChanged(const QString &prope
         permanentHardwareAddress = value.toString();
         Q_EMIT q->permanentHardwareAddressChanged(permanentHardwareAddress);
     } else if (property == QLatin1String("Bitrate")) {
-        bitRate = value.toUInt();
-        Q_EMIT q->bitRateChanged(bitRate);
+        bitRate = value.toInt();
+        Q_EMIT q->bitRateChanged(bitRate.value());
     } else if (property == QLatin1String("Mode")) {
         mode = q->convertOperationMode(value.toUInt());
         Q_EMIT q->modeChanged(mode);
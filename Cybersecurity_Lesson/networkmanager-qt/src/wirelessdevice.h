@@ -29,6 +29,8 @@ class NETWORKMANAGERQT_EXPORT WirelessDevice : public Device
 {
     Q_OBJECT
 
+    Q_PROPERTY(int bitRate READ bitRate NOTIFY bitRateChanged BINDABLE bindableBitRate)
+
 public:
     typedef QSharedPointer<WirelessDevice> Ptr;
     typedef QList<Ptr> List;
@@ -115,6 +117,11 @@ public:
      * @return the bitrate in Kbit/s
      */
     int bitRate() const;
+    /**
+     * Bindable counterpart of bitRate()
+     * @since 5.94.0
+     */
+    QBindable<int> bindableBitRate();
     /**
      * The LastScan property value, converted to QDateTime
      * @since 5.62.0
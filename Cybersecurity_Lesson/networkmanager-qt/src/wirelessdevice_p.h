@@ -26,7 +26,7 @@ public:
     // index of the active AP or -1 if none
     AccessPoint::Ptr activeAccessPoint;
     WirelessDevice::OperationMode mode;
-    uint bitRate;
+    Q_OBJECT_BINDABLE_PROPERTY_WITH_ARGS(WirelessDevicePrivate, int, bitRate, 0)
     WirelessDevice::Capabilities wirelessCapabilities;
     QDateTime lastScan;
     QDateTime lastRequestScan;
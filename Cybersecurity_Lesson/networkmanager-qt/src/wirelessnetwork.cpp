@@ -65,9 +65,9 @@ void NetworkManager::WirelessNetworkPrivate::updateStrength()
             strongestAp = iface;
         }
     }
-    if (maximumStrength != strength) {
+    if (maximumStrength != strength.value()) {
         strength = maximumStrength;
-        Q_EMIT q->signalStrengthChanged(strength);
+        Q_EMIT q->signalStrengthChanged(maximumStrength);
     }
 
     if (strongestAp && referenceAp != strongestAp) {
@@ -105,6 +105,12 @@ int NetworkManager::WirelessNetwork::signalStrength() const
     return d->strength;
 }
 
+QBindable<int> NetworkManager::WirelessNetwork::bindableSignalStrength()
+{
+    Q_D(WirelessNetwork);
+    return &d->strength;
+}
+
 NetworkManager::AccessPoint::Ptr NetworkManager::WirelessNetwork::referenceAccessPoint() const
 {
     Q_D(const WirelessNetwork);
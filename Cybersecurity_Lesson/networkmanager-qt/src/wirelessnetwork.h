@@ -13,6 +13,7 @@
 #include <networkmanagerqt/networkmanagerqt_export.h>
 
 #include <QObject>
+#include <QProperty>
 #include <QSharedPointer>
 
 namespace NetworkManager
@@ -27,6 +28,8 @@ class WirelessNetworkPrivate;
 class NETWORKMANAGERQT_EXPORT WirelessNetwork : public QObject
 {
     Q_OBJECT
+    Q_PROPERTY(QString ssid READ ssid CONSTANT)
+    Q_PROPERTY(int signalStrength READ signalStrength NOTIFY signalStrengthChanged BINDABLE bindableSignalStrength)
     friend class WirelessDevice;
     friend class WirelessDevicePrivate;
 
@@ -44,6 +47,13 @@ public:
      * point and watching its signal strength
      */
     int signalStrength() const;
+    /**
+     * Bindable counterpart of signalStrength(). Bindings depending on it are
+     * re-evaluated as soon as the strength changes, whether or not they are
+     * read.
+     * @since 5.94.0
+     */
+    QBindable<int> bindableSignalStrength();
 
     /**
      * The uni of the current 'best' (strongest) Access Point. Note that this may change or disappear over time.
@@ -11,6 +11,7 @@
 #include "wirelessdevice.h"
 
 #include <QPointer>
+#include <QProperty>
 
 namespace NetworkManager
 {
@@ -26,7 +27,8 @@ public:
     void addAccessPointInternal(const AccessPoint::Ptr &accessPoint);
 
     QString ssid;
-    int strength;
+    // Not a QObject, hence a plain QProperty instead of a QObjectBindableProperty
+    QProperty<int> strength;
     QPointer<WirelessDevice> wirelessNetworkInterface;
     QHash<QString, AccessPoint::Ptr> aps;
     AccessPoint::Ptr referenceAp;
@@ -0,0 +1,179 @@
+/* Network Model Benchmark
+** File: network_model_benchmark.cpp
+** --------
+** Benchmarks of the network model, rows are inserted directly
+** so the numbers don't depend on the networks around
+** --------
+*/
+
+/* Qt include files */
+#include <QTest>
+#include <QTreeView>
+
+#ifdef HAVE_MALLINFO2
+#include <malloc.h>
+#endif
+
+/* local include files */
+#include "network_model.h"
+#include "network_model_benchmark.h"
+
+static const int RowCount = 10000;
+
+
+/* Columns shown by the wardriving tab */
+static QVector<ItemRole> columns ()
+{
+    return {ItemRole::NameRole, ItemRole::SecurityTypeRole};
+}
+
+
+/* Fill model with network rows, each with one access point row
+** Parameters:
+**     model: empty model
+*/
+static void populate (NetworkModel &model)
+{
+    model.insertRows (0, RowCount);
+    for (int row = 0; row < RowCount; ++row)
+        model.insertRows (0, 1, model.index (row, 0));
+}
+
+
+/* Fill a tree of items the way a scan does
+** Parameters:
+**     root: root item of the tree
+*/
+static void fill (NetworkItem *root)
+{
+    QVector<NetworkItem*> items;
+    items.reserve (RowCount);
+    for (int row = 0; row < RowCount; ++row)
+    {
+        NetworkItem *item = new NetworkItem (root);
+        const QString ssid = QStringLiteral("Network %1").arg (row);
+        item->setDeviceName (QStringLiteral("wlan0"));
+        item->setDevicePath (QStringLiteral("/org/freedesktop/NetworkManager/Devices/3"));
+        item->setName (ssid);
+        item->setSsid (ssid);
+        item->setSpecificPath (QStringLiteral("/org/freedesktop/NetworkManager/AccessPoint/%1").arg (row));
+        item->setType (NetworkManager::ConnectionSettings::Wireless);
+        item->setSecurityType (NetworkManager::Wpa2Psk);
+        item->setSignalStrength (row % 100);
+        item->setFrequency (2437);
+        item->clearChangedRoles();
+        items << item;
+    }
+    root->insertChildren (0, items);
+}
+
+
+/* Bytes of heap in use, 0 where the C library can't tell */
+static qint64 heapInUse ()
+{
+#ifdef HAVE_MALLINFO2
+    return qint64 (mallinfo2().uordblks);
+#else
+    return 0;
+#endif
+}
+
+
+/* Parent of every access point row, with the rows of the
+** network rows up to date
+*/
+void NetworkModelBenchmark::parentOfChild ()
+{
+    NetworkModel model (columns());
+    populate (model);
+
+    QVector<QModelIndex> children;
+    for (int row = 0; row < RowCount; ++row)
+        children << model.index (0, 0, model.index (row, 0));
+
+    QBENCHMARK {
+        for (const QModelIndex &child : std::as_const(children))
+            model.parent (child);
+    }
+
+    QCOMPARE (model.parent (children.constLast()).row(), RowCount - 1);
+}
+
+
+/* Parent of every access point row after the first network
+** row went away, so every row below it has to be renumbered
+*/
+void NetworkModelBenchmark::parentAfterRemoval ()
+{
+    NetworkModel model (columns());
+    populate (model);
+
+    // the access point of the first row goes away with it
+    QVector<QModelIndex> children;
+    for (int row = 1; row < RowCount; ++row)
+        children << model.index (0, 0, model.index (row, 0));
+
+    QBENCHMARK {
+        model.removeRows (0, 1);
+        model.insertRows (0, 1);
+        for (const QModelIndex &child : std::as_const(children))
+            model.parent (child);
+    }
+
+    QCOMPARE (model.parent (children.constLast()).row(), RowCount - 1);
+}
+
+
+/* Create and fill the items of every row */
+void NetworkModelBenchmark::fillRows ()
+{
+    QBENCHMARK {
+        NetworkItem *root = new NetworkItem (QVector<QVariant> {QString(), QString()});
+        fill (root);
+        delete root;
+    }
+}
+
+
+/* Heap used per filled network row, printed next to the timings */
+void NetworkModelBenchmark::memoryPerRow ()
+{
+    if (!heapInUse())
+        QSKIP("heap usage is only known with mallinfo2()");
+
+    const qint64 before = heapInUse();
+    NetworkItem *root = new NetworkItem (QVector<QVariant> {QString(), QString()});
+    fill (root);
+    const qint64 after = heapInUse();
+
+    qInfo ("%lld bytes per row", (after - before) / RowCount);
+    QCOMPARE (root->childCount(), RowCount);
+    delete root;
+}
+
+
+/* Paint a screen of network rows in the middle of the list,
+** set up like the tree view of the wardriving tab. Every cell
+** asks for its roles through multiData() and its decoration
+** from the icon cache.
+*/
+void NetworkModelBenchmark::paint ()
+{
+    NetworkModel model (columns());
+    model.insertRows (0, RowCount);
+
+    QTreeView view;
+    view.setModel (&model);
+    view.setIndentation (10);
+    view.setIconSize (QSize (36, 36));
+    view.setColumnWidth (0, 290);
+    view.resize (640, 960);
+    view.scrollTo (model.index (RowCount / 2, 0));
+
+    QBENCHMARK {
+        view.viewport()->grab();
+    }
+}
+
+
+QTEST_MAIN(NetworkModelBenchmark)
@@ -0,0 +1,21 @@
+#ifndef NetworkModelBenchmark_H
+#define NetworkModelBenchmark_H
+
+#include <QObject>
+
+/* Timings of the network model with as many rows as a busy
+** scan produces, NetworkManager doesn't have to be running
+*/
+class NetworkModelBenchmark : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void parentOfChild ();
+    void parentAfterRemoval ();
+    void fillRows ();
+    void memoryPerRow ();
+    void paint ();
+};
+
+#endif // NetworkModelBenchmark_H
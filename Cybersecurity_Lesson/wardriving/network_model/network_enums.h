@@ -27,6 +27,7 @@ enum ItemRole {
     DevicePathRole,
     DeviceStateRole,
     DuplicateRole,
+    FrequencyRole,
     HeaderRole,
     ItemUniqueNameRole,
     ItemTypeRole,
@@ -0,0 +1,151 @@
+/* Network Icons
+** File: network_icons.cpp
+** --------
+** Pre-rendered decoration icons of the network model
+** --------
+*/
+
+/* Qt include files */
+#include <QGuiApplication>
+#include <QPainter>
+
+/* local include files */
+#include "network_icons.h"
+
+#include "custom_colors.h"
+
+QHash<quint64, QPixmap> NetworkIcons::s_pixmaps;
+QIcon NetworkIcons::s_icons[NetworkIcons::StateCount];
+
+
+/* Map a signal strength to its bars
+** Parameters:
+**     strength: signal strength in percent
+** Return: state showing the matching number of bars
+*/
+NetworkIcons::State NetworkIcons::signalState (int strength)
+{
+    if (strength < 5)
+        return SignalNone;
+    if (strength < 30)
+        return SignalWeak;
+    if (strength < 55)
+        return SignalOk;
+    if (strength < 80)
+        return SignalGood;
+
+    return SignalExcellent;
+}
+
+
+/* Return the shared icon of a state
+** The icon holds pixmaps for the usual view sizes at the
+** device pixel ratio of the application, rendered on first use
+*/
+const QIcon &NetworkIcons::icon (State state)
+{
+    QIcon &icon = s_icons[state];
+    if (icon.isNull())
+    {
+        const qreal devicePixelRatio = qGuiApp ? qGuiApp->devicePixelRatio() : 1.0;
+        for (int size : {16, 22, 24, 32, 36})
+            icon.addPixmap (pixmap (state, size, devicePixelRatio));
+    }
+
+    return icon;
+}
+
+
+/* Return the pixmap of a state, rendered once per key
+** Parameters:
+**     state: icon to show
+**     size: logical width and height
+**     devicePixelRatio: ratio of the screen it is painted on
+*/
+QPixmap NetworkIcons::pixmap (State state, int size, qreal devicePixelRatio)
+{
+    const quint64 pixmapKey = key (state, size, devicePixelRatio);
+    auto it = s_pixmaps.constFind (pixmapKey);
+    if (it == s_pixmaps.constEnd())
+        it = s_pixmaps.insert (pixmapKey, render (state, size, devicePixelRatio));
+
+    return it.value();
+}
+
+
+/* Drop every rendered icon, for instance after the
+** screen or the palette changed
+*/
+void NetworkIcons::clear ()
+{
+    s_pixmaps.clear();
+    for (QIcon &icon : s_icons)
+        icon = QIcon();
+}
+
+
+quint64 NetworkIcons::key (State state, int size, qreal devicePixelRatio)
+{
+    return quint64 (state)
+            | quint64 (quint16 (size)) << 8
+            | quint64 (quint16 (qRound (devicePixelRatio * 100))) << 24;
+}
+
+
+/* Render one pixmap, the only place the svg files are read */
+QPixmap NetworkIcons::render (State state, int size, qreal devicePixelRatio)
+{
+    QString file;
+    switch (state) {
+    case WirelessOpen:
+        file = QStringLiteral(":/icons/network/24/network-wireless.svg");
+        break;
+    case WirelessAvailable:
+        file = QStringLiteral(":/icons/network/24/network-wireless-available.svg");
+        break;
+    case WirelessLocked:
+        file = QStringLiteral(":/icons/network/24/network-wireless-locked.svg");
+        break;
+    case Wired:
+        file = QStringLiteral(":/icons/network/24/network-wired.svg");
+        break;
+    case StateCount:
+        return QPixmap();
+    default:
+        return renderSignal (state - SignalNone, size, devicePixelRatio);
+    }
+
+    return QIcon (file).pixmap (QSize (size, size), devicePixelRatio);
+}
+
+
+/* Draw four signal bars, the first "bars" of them lit */
+QPixmap NetworkIcons::renderSignal (int bars, int size, qreal devicePixelRatio)
+{
+    QPixmap pixmap (QSize (size, size) * devicePixelRatio);
+    pixmap.setDevicePixelRatio (devicePixelRatio);
+    pixmap.fill (Qt::transparent);
+
+    const QColor lit = CustomColors::frame_font_color();
+    QColor unlit = lit;
+    unlit.setAlpha (60);
+
+    QPainter painter (&pixmap);
+    painter.setRenderHint (QPainter::Antialiasing);
+    painter.setPen (Qt::NoPen);
+
+    const qreal margin = size / 8.0;
+    const qreal step = (size - 2 * margin) / 4;
+    for (int bar = 0; bar < 4; ++bar)
+    {
+        const qreal height = step * (bar + 1);
+        const QRectF rect (margin + bar * step + step / 6,
+                           size - margin - height,
+                           step * 2 / 3,
+                           height);
+        painter.setBrush (bar < bars ? lit : unlit);
+        painter.drawRoundedRect (rect, 1, 1);
+    }
+
+    return pixmap;
+}
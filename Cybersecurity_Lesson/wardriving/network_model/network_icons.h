@@ -0,0 +1,45 @@
+#ifndef NetworkIcons_H
+#define NetworkIcons_H
+
+#include <QHash>
+#include <QIcon>
+#include <QPixmap>
+
+/* Icons of the network model rendered once and shared by every
+** row, so that decoration lookups only copy an existing icon
+*/
+class NetworkIcons
+{
+public:
+    enum State : quint8 {
+        WirelessOpen,
+        WirelessAvailable,
+        WirelessLocked,
+        Wired,
+        SignalNone,
+        SignalWeak,
+        SignalOk,
+        SignalGood,
+        SignalExcellent,
+        StateCount,
+    };
+
+    static State signalState (int strength);
+
+    static const QIcon &icon (State state);
+    static QPixmap pixmap (State state, int size, qreal devicePixelRatio);
+
+    static void clear();
+
+private:
+    static QPixmap render (State state, int size, qreal devicePixelRatio);
+    static QPixmap renderSignal (int bars, int size, qreal devicePixelRatio);
+
+    // (state, size, devicePixelRatio) packed into one key
+    static quint64 key (State state, int size, qreal devicePixelRatio);
+
+    static QHash<quint64, QPixmap> s_pixmaps;
+    static QIcon s_icons[StateCount];
+};
+
+#endif // NetworkIcons_H
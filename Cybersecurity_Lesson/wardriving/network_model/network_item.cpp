@@ -6,9 +6,11 @@
 */
 
 /* Qt include files */
-#include <QIcon>
+#include <QtAlgorithms>
 #include <QStringBuilder>
 
+#include <algorithm>
+
 /* NetworkManager Include files */
 #include <NetworkManagerQt/Manager>
 #include <NetworkManagerQt/Settings>
@@ -22,29 +24,32 @@
 
 NetworkItem::NetworkItem (NetworkItem *parent)
     : m_parentItem(parent),
-      indent(1,' ')
+      m_table(parent ? parent->m_table : new NetworkTable)
 {
+    m_slot = m_table->allocate();
 }
 
 NetworkItem::NetworkItem (const QVector<QVariant> &data, NetworkItem *parent)
-    : m_headerData(data),
-      m_parentItem(parent),
-      indent(1,' ')
+    : m_parentItem(parent),
+      m_table(parent ? parent->m_table : new NetworkTable)
 {
-    for (int i = 0; i < m_headerData.size(); ++i)
-    {
-        this->insertRole (ItemRole::HeaderRole);
-    }
+    m_slot = m_table->allocate();
+    m_table->headerData = data;
 }
 
 NetworkItem::~NetworkItem()
 {
     qDeleteAll (m_childItems);
+    m_table->release (m_slot);
+
+    // the root item owns the table of the model
+    if (!m_parentItem)
+        delete m_table;
 }
 
 
 /* return pointer to parent */
-NetworkItem *NetworkItem::parent()
+NetworkItem *NetworkItem::parent() const
 {
     return m_parentItem;
 }
@@ -67,16 +72,32 @@ int NetworkItem::childCount() const
 /* return zero for the root item */
 int NetworkItem::childNumber() const
 {
-    if (m_parentItem)
-        return m_parentItem->m_childItems.indexOf
-                (const_cast<NetworkItem*>(this));
-    return 0;
+    if (!m_parentItem)
+        return 0;
+
+    if (m_parentItem->m_firstDirtyRow < m_parentItem->m_childItems.size())
+        m_parentItem->renumberChildren();
+
+    return m_row;
 }
 
-/* return number of elements in the internal itemData list */
+/* store the row of every child after the first outdated one */
+/* done once for all insertions and removals since the last lookup */
+void NetworkItem::renumberChildren() const
+{
+    for (int row = m_firstDirtyRow; row < m_childItems.size(); ++row)
+        m_childItems.at(row)->m_row = row;
+
+    m_firstDirtyRow = m_childItems.size();
+}
+
+/* return number of columns of the shared schema */
 int NetworkItem::columnCount() const
 {
-    return m_roles.count();
+    if (!m_parentItem)
+        return m_table->headerData.count();
+
+    return m_table->columnRoles.count();
 }
 
 /* insert row below specified index  */
@@ -85,109 +106,162 @@ bool NetworkItem::insertChildren (int position, int count, int columns)
     if (position < 0 || position > m_childItems.size())
         return false;
 
-    for (int row = 0; row < count; ++row)
-    {
-        NetworkItem *item = new NetworkItem (this);
-        m_childItems.insert (position, item);
-    }
+    // shift the following rows once for the whole range
+    m_childItems.insert (position, count, nullptr);
+    for (int row = position; row < position + count; ++row)
+        m_childItems[row] = new NetworkItem (this);
+
+    m_firstDirtyRow = qMin (m_firstDirtyRow, position);
 
     return true;
 }
 
-/* remove row at specified index */
-bool NetworkItem::removeChildren (int position, int count)
+/* insert already filled items below specified index */
+bool NetworkItem::insertChildren (int position, const QVector<NetworkItem*> &items)
 {
-    if (position < 0 || position + count > m_childItems.size())
+    if (position < 0 || position > m_childItems.size())
         return false;
 
-    for (int row = 0; row < count; ++row)
-        delete m_childItems.takeAt(position);
+    for (NetworkItem *item : items)
+        item->m_parentItem = this;
+
+    m_childItems.insert (position, items.size(), nullptr);
+    std::copy (items.cbegin(), items.cend(), m_childItems.begin() + position);
+
+    m_firstDirtyRow = qMin (m_firstDirtyRow, position);
 
     return true;
 }
 
+/* move row at "from" so that it ends up at "to" */
+bool NetworkItem::moveChild (int from, int to)
+{
+    if (from < 0 || from >= m_childItems.size()
+        || to < 0 || to >= m_childItems.size())
+        return false;
 
-/* temporary until better role handling */
-QString getSecurityString (NetworkManager::WirelessSecurityType type)
-{   
-    switch (type) {
-    case NetworkManager::NoneSecurity:
-        return QStringLiteral("None");
-        break;
+    m_childItems.move (from, to);
+    m_firstDirtyRow = qMin (m_firstDirtyRow, qMin (from, to));
 
-    case NetworkManager::StaticWep:
-        return QStringLiteral("Static-Wep");
-        break;
+    return true;
+}
 
-    case NetworkManager::DynamicWep:
-        return QStringLiteral("Dynamic-Wep");
-        break;
+/* reorder children, keeping the order of equal ones */
+void NetworkItem::sortChildren (const std::function<bool (const NetworkItem*, const NetworkItem*)> &lessThan)
+{
+    std::stable_sort (m_childItems.begin(), m_childItems.end(), lessThan);
+    m_firstDirtyRow = 0;
+}
 
-    case NetworkManager::Leap:
-        return QStringLiteral("Leap");
-        break;
+/* remove row at specified index */
+bool NetworkItem::removeChildren (int position, int count)
+{
+    if (position < 0 || position + count > m_childItems.size())
+        return false;
 
-    case NetworkManager::WpaPsk:
-        return QStringLiteral("Wpa-Psk");
-        break;
+    qDeleteAll (m_childItems.begin() + position,
+                m_childItems.begin() + position + count);
+    m_childItems.remove (position, count);
 
-    case NetworkManager::WpaEap:
-        return QStringLiteral("Wpa-Eap");
-        break;
+    m_firstDirtyRow = qMin (m_firstDirtyRow, position);
 
-    case NetworkManager::Wpa2Psk:
-        return QStringLiteral("Wpa2-Psk");
-        break;
+    return true;
+}
 
-    case NetworkManager::Wpa2Eap:
-        return QStringLiteral("Wpa2-Eap");
-        break;
 
-    case NetworkManager::SAE:
-        return QStringLiteral("SAE");
-        break;
+/* Names of the security types, indexed by type + 1 and built
+** once, so that every row shares the same strings
+*/
+struct SecurityStrings
+{
+    QString names[NetworkManager::Wpa3SuiteB192 + 2];
+    QString indented[NetworkManager::Wpa3SuiteB192 + 2];
+};
 
-    case NetworkManager::Wpa3SuiteB192:
-        return QStringLiteral("Wpa3-Suite-B192");
-        break;
+static const SecurityStrings &securityStrings ()
+{
+    static const SecurityStrings strings = []() {
+        SecurityStrings built;
+        built.names[0] = QStringLiteral("Unknown");
+        built.names[NetworkManager::NoneSecurity + 1] = QStringLiteral("None");
+        built.names[NetworkManager::StaticWep + 1] = QStringLiteral("Static-Wep");
+        built.names[NetworkManager::DynamicWep + 1] = QStringLiteral("Dynamic-Wep");
+        built.names[NetworkManager::Leap + 1] = QStringLiteral("Leap");
+        built.names[NetworkManager::WpaPsk + 1] = QStringLiteral("Wpa-Psk");
+        built.names[NetworkManager::WpaEap + 1] = QStringLiteral("Wpa-Eap");
+        built.names[NetworkManager::Wpa2Psk + 1] = QStringLiteral("Wpa2-Psk");
+        built.names[NetworkManager::Wpa2Eap + 1] = QStringLiteral("Wpa2-Eap");
+        built.names[NetworkManager::SAE + 1] = QStringLiteral("SAE");
+        built.names[NetworkManager::Wpa3SuiteB192 + 1] = QStringLiteral("Wpa3-Suite-B192");
 
-    default:
-        return QStringLiteral("Unknown");
-    }
+        for (int i = 0; i <= NetworkManager::Wpa3SuiteB192 + 1; ++i)
+            built.indented[i] = QChar(u' ') + built.names[i];
+        return built;
+    }();
 
-    return QStringLiteral("error");
+    return strings;
+}
+
+static int securityIndex (NetworkManager::WirelessSecurityType type)
+{
+    if (type < NetworkManager::UnknownSecurity || type > NetworkManager::Wpa3SuiteB192)
+        return 0;
+
+    return type + 1;
+}
+
+/* name of a security type */
+const QString &NetworkItem::securityString (NetworkManager::WirelessSecurityType type)
+{
+    return securityStrings().names[securityIndex (type)];
 }
 
 
-/* retrieve data from itemData list at specified column */
+/* column text with the margin used by the view */
+static QString indented (const QString &text)
+{
+    return QChar(u' ') + text;
+}
+
+
+/* retrieve data at specified column of the shared schema */
 QVariant NetworkItem::data (int column) const
 {
-    if (column < 0 || column >= m_roles.size())
+    if (column < 0 || column >= columnCount())
         return QVariant();
 
-    switch (m_roles.at(column)) {
+    const NetworkTable &table = *m_table;
+    const int row = m_slot;
+
+    switch (getRole (column)) {
     case ConnectionIconRole:
-        return QIcon (m_icon);
+        return NetworkIcons::icon (iconState());
     case ConnectionStateRole:
-        return m_connectionState;
+        return connectionState();
     case TypeRole:
-        return m_type;
+        return type();
     case DeviceName:
-        return indent + m_deviceName.toString();
+        return indented (table.strings.at(table.deviceName.at(row)));
     case DevicePathRole:
-        return indent + m_devicePath.toString();
+        return indented (table.strings.at(table.devicePath.at(row)));
     case HeaderRole:
-        return indent + m_headerData[column].toString();
+        return indented (table.headerData.at(column).toString());
     case NameRole:
-        return indent + m_name;
+        return indented (table.strings.at(table.name.at(row)));
     case SsidRole:
-        return indent + m_ssid.toString();
+        return indented (table.strings.at(table.ssid.at(row)));
     case SpecificPathRole:
-        return indent + m_specificPath.toString();
+        return indented (table.strings.at(table.specificPath.at(row)));
     case SecurityTypeRole:
-        return indent + getSecurityString(m_securityType);
+        return securityStrings().indented[securityIndex (securityType())];
+    case SignalRole:
+        return signalStrength();
+    case FrequencyRole:
+        return frequency();
+    case TimeStampRole:
+        return lastSeen();
     case UuidRole:
-        return indent + m_uuid.toString();
+        return indented (table.strings.at(table.uuid.at(row)));
     default:
         break;
     }
@@ -199,10 +273,10 @@ QVariant NetworkItem::data (int column) const
 /* retrieve data from headerData list at specified column */
 QVariant NetworkItem::headerData (int column) const
 {
-    if (column < 0 || column >= m_headerData.size())
+    if (m_parentItem || column < 0 || column >= m_table->headerData.size())
         return QVariant();
 
-    return m_headerData[column];
+    return m_table->headerData.at(column);
 }
 
 
@@ -210,11 +284,11 @@ QVariant NetworkItem::headerData (int column) const
 bool NetworkItem::setHeaderData (int column, const QVariant &value)
 {
 
-    if (column < 0 || column >= m_headerData.size())
+    if (m_parentItem || column < 0 || column >= m_table->headerData.size())
         return false;
 
-    if (m_headerData[column] != value) {
-        m_headerData[column] = value;
+    if (m_table->headerData.at(column) != value) {
+        m_table->headerData[column] = value;
         return true;
     }
     else {
@@ -223,20 +297,98 @@ bool NetworkItem::setHeaderData (int column, const QVariant &value)
 }
 
 
+/* Column Schema
+** --------
+** Every row of a model has the same columns, the root
+** item shows the header in each of them
+** --------
+**/
+
+int NetworkItem::getRole (int index) const
+{
+    if (!m_parentItem)
+        return ItemRole::HeaderRole;
+
+    return m_table->columnRoles.at(index);
+}
+
+/* add a column to the schema unless it already has one for role */
+void NetworkItem::insertRole (const ItemRole role)
+{
+    if (!m_table->columnRoles.contains (role))
+        m_table->columnRoles << role;
+}
+
+void NetworkItem::setColumnRoles (const QVector<ItemRole> &roles)
+{
+    m_table->columnRoles = QVector<int> (roles.cbegin(), roles.cend());
+}
+
+
+/* Sorting */
+NetworkItem::SortKey NetworkItem::sortKey() const
+{
+    return SortKey {sortNumber(), sortText()};
+}
+
+void NetworkItem::setSortKey (const SortKey &key)
+{
+    m_table->sortNumber[m_slot] = key.number;
+    m_table->setString (m_table->sortText, m_slot, key.text);
+}
+
+qint64 NetworkItem::sortNumber() const
+{
+    return m_table->sortNumber.at(m_slot);
+}
+
+const QString &NetworkItem::sortText() const
+{
+    return m_table->strings.at(m_table->sortText.at(m_slot));
+}
+
+
+/* Changed Roles
+** --------
+** One bit per ItemRole, collected until the model
+** reports the change to the view
+** --------
+**/
+
+void NetworkItem::roleChanged (int role)
+{
+    m_table->changedRoles[m_slot] |= 1u << (role - ItemRole::ConnectionDetailsRole);
+}
+
+QVector<int> NetworkItem::changedRoles() const
+{
+    QVector<int> roles;
+    for (quint32 bits = m_table->changedRoles.at(m_slot); bits; bits &= bits - 1)
+        roles << ItemRole::ConnectionDetailsRole + qCountTrailingZeroBits (bits);
+
+    return roles;
+}
+
+void NetworkItem::clearChangedRoles()
+{
+    m_table->changedRoles[m_slot] = 0;
+}
+
+
 /*
  *  Network Items
  */
 NetworkManager::ActiveConnection::State NetworkItem::connectionState() const
 {
-    return m_connectionState;
+    return NetworkManager::ActiveConnection::State (m_table->connectionState.at(m_slot));
 }
 
 void NetworkItem::setConnectionState(NetworkManager::ActiveConnection::State state)
 {
-    if (m_connectionState != state)
+    if (connectionState() != state)
     {
-        m_connectionState = state;
-        m_changedRoles << ItemRole::ConnectionStateRole;
+        m_table->connectionState[m_slot] = state;
+        roleChanged (ItemRole::ConnectionStateRole);
         refreshIcon();
     }
 }
@@ -244,171 +396,213 @@ void NetworkItem::setConnectionState(NetworkManager::ActiveConnection::State sta
 
 QVariant NetworkItem::deviceName() const
 {
-    return m_deviceName;
+    return m_table->strings.at(m_table->deviceName.at(m_slot));
 }
 
 void NetworkItem::setDeviceName (const QVariant &name)
 {
-    if (m_deviceName != name)
-    {
-        m_deviceName = name;
-        m_changedRoles << ItemRole::DeviceName;
-    }
+    if (m_table->setString (m_table->deviceName, m_slot, name.toString()))
+        roleChanged (ItemRole::DeviceName);
 }
 
 
 QVariant NetworkItem::devicePath() const
 {
-    return m_devicePath;
+    return m_table->strings.at(m_table->devicePath.at(m_slot));
 }
 
 void NetworkItem::setDevicePath (const QVariant &path)
 {
-    if (m_devicePath != path)
-    {
-        m_devicePath = path;
-        m_changedRoles << ItemRole::DevicePathRole;
-    }
+    if (m_table->setString (m_table->devicePath, m_slot, path.toString()))
+        roleChanged (ItemRole::DevicePathRole);
 }
 
 
-QString NetworkItem::icon() const
+NetworkIcons::State NetworkItem::iconState() const
 {
-    return m_icon;
+    return NetworkIcons::State (m_table->iconState.at(m_slot));
 }
 
-void NetworkItem::setIcon (const QString &icon)
+void NetworkItem::setIconState (NetworkIcons::State state)
 {
-    if (icon != m_icon)
+    if (iconState() != state)
     {
-        m_icon = icon;
-        m_changedRoles << ItemRole::ConnectionIconRole;
+        m_table->iconState[m_slot] = state;
+        roleChanged (ItemRole::ConnectionIconRole);
     }
 }
 
 void NetworkItem::refreshIcon()
 {
-    setIcon(computeIcon());
+    setIconState(computeIcon());
 }
 
-QString NetworkItem::computeIcon() const
+NetworkIcons::State NetworkItem::computeIcon() const
 {
-    switch (m_type) {
+    switch (type()) {
     case NetworkManager::ConnectionSettings::Bridge:
         break;
 
     case NetworkManager::ConnectionSettings::Wired:
-        if (m_connectionState == NetworkManager::ActiveConnection::Activated)
-            return QStringLiteral("network-wired");
-        else
-            return QStringLiteral("network-wired");
-        break;
+        return NetworkIcons::Wired;
 
     case NetworkManager::ConnectionSettings::Wireless:
-        if (m_securityType == NetworkManager::NoneSecurity)
-            return QStringLiteral(":/icons/network/24/network-wireless.svg");
-        else if (m_securityType == NetworkManager::UnknownSecurity)
-            return QStringLiteral(":/icons/network/24/network-wireless-available.svg");
+        if (securityType() == NetworkManager::NoneSecurity)
+            return NetworkIcons::WirelessOpen;
+        else if (securityType() == NetworkManager::UnknownSecurity)
+            return NetworkIcons::WirelessAvailable;
         else
-            return QStringLiteral(":/icons/network/24/network-wireless-locked.svg");
+            return NetworkIcons::WirelessLocked;
 
     default:
         break;
     }
 
-    if (m_connectionState == NetworkManager::ActiveConnection::Activated)
-        return QStringLiteral("network-wired");
-    else
-        return QStringLiteral("network-wired");
+    return NetworkIcons::Wired;
 }
 
 
 QString NetworkItem::name() const
 {
-    return m_name;
+    return m_table->strings.at(m_table->name.at(m_slot));
 }
 
 void NetworkItem::setName(const QString &name)
 {
-    if (m_name != name) {
-        m_name = name;
-        m_changedRoles << ItemRole::ItemUniqueNameRole << ItemRole::NameRole;
+    if (m_table->setString (m_table->name, m_slot, name)) {
+        roleChanged (ItemRole::ItemUniqueNameRole);
+        roleChanged (ItemRole::NameRole);
     }
 }
 
 
 QVariant NetworkItem::specificPath() const
 {
-    return m_specificPath;
+    return m_table->strings.at(m_table->specificPath.at(m_slot));
 }
 
 void NetworkItem::setSpecificPath (const QVariant &path)
 {
-    if (m_specificPath != path)
-    {
-        m_specificPath = path;
-        m_changedRoles << ItemRole::SpecificPathRole;
-    }
+    if (m_table->setString (m_table->specificPath, m_slot, path.toString()))
+        roleChanged (ItemRole::SpecificPathRole);
 }
 
 
 NetworkManager::WirelessSecurityType NetworkItem::securityType() const
 {
-    return m_securityType;
+    return NetworkManager::WirelessSecurityType (m_table->securityType.at(m_slot));
 }
 
 void NetworkItem::setSecurityType (NetworkManager::WirelessSecurityType type)
 {
-    if (m_securityType != type)
+    if (securityType() != type)
     {
-        m_securityType = type;
-        m_changedRoles << ItemRole::SecurityTypeStringRole << ItemRole::SecurityTypeRole;
+        m_table->securityType[m_slot] = type;
+        roleChanged (ItemRole::SecurityTypeStringRole);
+        roleChanged (ItemRole::SecurityTypeRole);
         refreshIcon();
     }
 }
 
 
+int NetworkItem::signalStrength() const
+{
+    return m_table->signalStrength.at(m_slot);
+}
+
+void NetworkItem::setSignalStrength (int strength)
+{
+    if (signalStrength() != strength)
+    {
+        m_table->signalStrength[m_slot] = strength;
+        roleChanged (ItemRole::SignalRole);
+    }
+}
+
+
+uint NetworkItem::frequency() const
+{
+    return m_table->frequency.at(m_slot);
+}
+
+void NetworkItem::setFrequency (uint frequency)
+{
+    if (this->frequency() != frequency)
+    {
+        m_table->frequency[m_slot] = frequency;
+        roleChanged (ItemRole::FrequencyRole);
+    }
+}
+
+
+int NetworkItem::lastSeen() const
+{
+    return m_table->lastSeen.at(m_slot);
+}
+
+void NetworkItem::setLastSeen (int lastSeen)
+{
+    if (this->lastSeen() != lastSeen)
+    {
+        m_table->lastSeen[m_slot] = lastSeen;
+        roleChanged (ItemRole::TimeStampRole);
+    }
+}
+
+
+bool NetworkItem::childrenFetched() const
+{
+    return m_table->flags.at(m_slot) & NetworkTable::ChildrenFetched;
+}
+
+void NetworkItem::setChildrenFetched (bool fetched)
+{
+    if (fetched)
+        m_table->flags[m_slot] |= NetworkTable::ChildrenFetched;
+    else
+        m_table->flags[m_slot] &= ~NetworkTable::ChildrenFetched;
+}
+
+
 QVariant NetworkItem::ssid() const
 {
-    return m_ssid;
+    return m_table->strings.at(m_table->ssid.at(m_slot));
 }
 
 void NetworkItem::setSsid (const QVariant &ssid)
 {
-    if (m_ssid != ssid)
+    if (m_table->setString (m_table->ssid, m_slot, ssid.toString()))
     {
-        m_ssid = ssid;
-        m_changedRoles << ItemRole::SsidRole << ItemRole::UniRole;
+        roleChanged (ItemRole::SsidRole);
+        roleChanged (ItemRole::UniRole);
     }
 }
 
 
 QVariant NetworkItem::uuid() const
 {
-    return m_uuid;
+    return m_table->strings.at(m_table->uuid.at(m_slot));
 }
 
 void NetworkItem::setUuid (const QVariant &uuid)
 {
-    if (m_uuid != uuid)
-    {
-        m_uuid = uuid;
-        m_changedRoles << ItemRole::UuidRole;
-    }
+    if (m_table->setString (m_table->uuid, m_slot, uuid.toString()))
+        roleChanged (ItemRole::UuidRole);
 }
 
 
 NetworkManager::ConnectionSettings::ConnectionType NetworkItem::type() const
 {
-    return m_type;
+    return NetworkManager::ConnectionSettings::ConnectionType (m_table->type.at(m_slot));
 }
 
 void NetworkItem::setType (NetworkManager::ConnectionSettings::ConnectionType type)
 {
-    if (m_type != type)
+    if (this->type() != type)
     {
-        m_type = type;
-        m_changedRoles << ItemRole::TypeRole << ItemRole::ItemTypeRole;
+        m_table->type[m_slot] = type;
+        roleChanged (ItemRole::TypeRole);
+        roleChanged (ItemRole::ItemTypeRole);
 
         refreshIcon();
     }
@@ -8,6 +8,10 @@
 #include <NetworkManagerQt/Utils>
 
 #include "network_enums.h"
+#include "network_icons.h"
+#include "network_table.h"
+
+#include <functional>
 
 class NetworkItem
 {
@@ -18,14 +22,17 @@ public:
     ~NetworkItem();
 
     /* Tree Items */
-    NetworkItem *parent();
+    NetworkItem *parent() const;
     NetworkItem *child (int row);
     int childNumber() const;
     int childCount() const;
     int columnCount() const;
 
     bool insertChildren (int position, int count, int columns);
+    bool insertChildren (int position, const QVector<NetworkItem*> &items);
     bool removeChildren (int position, int count);
+    bool moveChild (int from, int to);
+    void sortChildren (const std::function<bool (const NetworkItem*, const NetworkItem*)> &lessThan);
 
     QVariant data (int column) const;
     bool setData (int column, const QVariant &value);
@@ -44,8 +51,8 @@ public:
     QVariant devicePath() const;
     void setDevicePath (const QVariant &path);
 
-    QString icon() const;
-    void setIcon (const QString &icon);
+    NetworkIcons::State iconState() const;
+    void setIconState (NetworkIcons::State state);
 
     QString name() const;
     void setName (const QString &network);
@@ -54,8 +61,21 @@ public:
     void setSpecificPath (const QVariant &path);
 
     NetworkManager::WirelessSecurityType securityType() const;
+    static const QString &securityString (NetworkManager::WirelessSecurityType type);
     void setSecurityType (NetworkManager::WirelessSecurityType type);
 
+    int signalStrength() const;
+    void setSignalStrength (int strength);
+
+    uint frequency() const;
+    void setFrequency (uint frequency);
+
+    int lastSeen() const;
+    void setLastSeen (int lastSeen);
+
+    bool childrenFetched() const;
+    void setChildrenFetched (bool fetched);
+
     QVariant ssid() const;
     void setSsid (const QVariant &ssid);
 
@@ -68,48 +88,43 @@ public:
     QVariant uni() const;
 
 
-    int getRole (int index) const
-    {
-        return m_roles.at(index);
-    }
-    void insertRole (const ItemRole roles)
-    {
-            m_roles << roles;
-    }
-
-    QVector<int> changedRoles()
-    {
-        return m_changedRoles;
-    }
-    void clearChangedRoles()
-    {
-        m_changedRoles.clear();
-    }
+    /* Column schema, shared by every item of a model */
+    int getRole (int index) const;
+    void insertRole (const ItemRole role);
+    void setColumnRoles (const QVector<ItemRole> &roles);
+
+    /* Sorting */
+    struct SortKey {
+        qint64 number = 0;
+        QString text;
+    };
+    SortKey sortKey() const;
+    void setSortKey (const SortKey &key);
+    qint64 sortNumber() const;
+    const QString &sortText() const;
+
+    QVector<int> changedRoles() const;
+    void clearChangedRoles();
 
 private:
     /* Tree Items */
     NetworkItem *m_parentItem;
     QVector<NetworkItem*> m_childItems;
-    QVector<QVariant> m_headerData;
-    QString indent;
+    void renumberChildren() const;
+
+    // row in the parent, valid unless the parent has a dirty row before it
+    mutable int m_row = 0;
+    // first child whose m_row is outdated, childCount() when none is
+    mutable int m_firstDirtyRow = 0;
 
     /* Network Items */
-    QString computeIcon() const;
+    NetworkIcons::State computeIcon() const;
     void refreshIcon();
+    void roleChanged (int role);
 
-    NetworkManager::ActiveConnection::State m_connectionState;
-    NetworkManager::WirelessSecurityType m_securityType;
-    NetworkManager::ConnectionSettings::ConnectionType m_type;
-    QVariant m_deviceName;
-    QVariant m_devicePath;
-    QString m_name;
-    QVariant m_specificPath;
-    QVariant m_ssid;
-    QVariant m_uuid;
-    QString m_icon;
-
-    QVector<int> m_roles;
-    QVector<int> m_changedRoles;
+    // fields live in the table of the model, owned by the root item
+    NetworkTable *m_table;
+    int m_slot;
 };
 
 #endif // NetworkItem_H
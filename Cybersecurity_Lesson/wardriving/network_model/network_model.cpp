@@ -8,10 +8,13 @@
 
 /* Qt include files */
 #include <QDBusInterface>
-#include <QIcon>
+#include <QSet>
 #include <QStringBuilder>
 #include <QTimer>
 
+#include <algorithm>
+#include <functional>
+
 /* NetworkManager Include files */
 #include <NetworkManagerQt/ConnectionSettings>
 #include <NetworkManagerQt/Manager>
@@ -58,6 +61,10 @@ NetworkModel::NetworkModel (const QVector<ItemRole> &roles, QObject *parent)
             rootData << "Security";
             break;
 
+        case ItemRole::SignalRole:
+            rootData << "Signal";
+            break;
+
         case ItemRole::SsidRole:
             rootData << "Ssid";
             break;
@@ -71,7 +78,9 @@ NetworkModel::NetworkModel (const QVector<ItemRole> &roles, QObject *parent)
         }
     }
     rootItem = new NetworkItem (rootData);
+    rootItem->setColumnRoles (roles);
     columnRoles = roles;
+    m_foregroundColor = CustomColors::frame_font_color();
 
 
     // Initialize first scan and then scan every 2 seconds
@@ -84,6 +93,12 @@ NetworkModel::NetworkModel (const QVector<ItemRole> &roles, QObject *parent)
              [&](){m_scanHandler->requestScan();});
     m_timer->start();
 
+    // Coalesce network changes into one update of the view
+    m_updateTimer = new QTimer (this);
+    m_updateTimer->setInterval (250);
+    m_updateTimer->setSingleShot (true);
+    connect (m_updateTimer, &QTimer::timeout, this, &NetworkModel::flushUpdates);
+
 
     // Initialize existing connections
     for (const NetworkManager::Device::Ptr &dev :
@@ -140,14 +155,10 @@ QVariant NetworkModel::data (const QModelIndex &index, int role) const
 
 //        break;
     case Qt::ForegroundRole:
-        return CustomColors::frame_font_color();
+        return m_foregroundColor;
         break;
     case Qt::DecorationRole:
-        // Display Network Symbol in first column
-        if (index.column() == 0)
-        {
-            return QIcon (item->icon());
-        }
+        return decoration (item, index.column());
         break;
     case Qt::DisplayRole:
         return item->data (index.column());
@@ -161,6 +172,68 @@ QVariant NetworkModel::data (const QModelIndex &index, int role) const
 }
 
 
+/* Return data of several roles in one call
+** Parameters:
+**     index: specify model index for row and column
+**     roleDataSpan: roles asked for, each gets its value
+*/
+void NetworkModel::multiData (const QModelIndex &index,
+                              QModelRoleDataSpan roleDataSpan) const
+{
+    if (!index.isValid())
+    {
+        for (QModelRoleData &roleData : roleDataSpan)
+            roleData.clearData();
+        return;
+    }
+
+    const NetworkItem *item = static_cast<const NetworkItem*>(index.internalPointer());
+
+    // Display and edit role share one value, built when first asked for
+    QVariant text;
+    bool textDone = false;
+
+    for (QModelRoleData &roleData : roleDataSpan)
+    {
+        switch (roleData.role()) {
+        case Qt::ForegroundRole:
+            roleData.setData (m_foregroundColor);
+            break;
+        case Qt::DecorationRole:
+            roleData.setData (decoration (item, index.column()));
+            break;
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+            if (!textDone)
+            {
+                text = item->data (index.column());
+                textDone = true;
+            }
+            roleData.setData (text);
+            break;
+        default:
+            roleData.clearData();
+            break;
+        }
+    }
+}
+
+
+/* Return the icon shown in a column of an item */
+QVariant NetworkModel::decoration (const NetworkItem *item, int column) const
+{
+    // Display Network Symbol in first column
+    if (column == 0)
+        return NetworkIcons::icon (item->iconState());
+
+    // and signal bars next to the signal strength
+    if (columnRoles.at(column) == ItemRole::SignalRole)
+        return NetworkIcons::icon (NetworkIcons::signalState (item->signalStrength()));
+
+    return QVariant();
+}
+
+
 /* Store value in model index */
 bool NetworkModel::setData (const QModelIndex &index,
                             const QVariant &network_role,
@@ -267,6 +340,69 @@ int NetworkModel::rowCount (const QModelIndex &parent) const
 }
 
 
+/* Return whether a row has children, network rows have
+** access points below them even before they are fetched
+*/
+bool NetworkModel::hasChildren (const QModelIndex &parent) const
+{
+    if (parent.isValid() && parent.column() > 0)
+        return false;
+
+    const NetworkItem *parentItem = d_ptr->getItem (parent, this);
+    if (parentItem->parent() == rootItem && !parentItem->childrenFetched())
+        return true;
+
+    return parentItem->childCount() > 0;
+}
+
+
+/* Return whether the access points of a network row are
+** still to be created, which happens once it gets expanded
+*/
+bool NetworkModel::canFetchMore (const QModelIndex &parent) const
+{
+    if (!parent.isValid() || parent.column() > 0)
+        return false;
+
+    const NetworkItem *parentItem = d_ptr->getItem (parent, this);
+    return parentItem->parent() == rootItem && !parentItem->childrenFetched();
+}
+
+
+/* Create the access point rows of a network row
+** Parameters:
+**     parent: index of the network row
+*/
+void NetworkModel::fetchMore (const QModelIndex &parent)
+{
+    if (!canFetchMore (parent))
+        return;
+
+    NetworkItem *parentItem = d_ptr->getItem (parent, this);
+    parentItem->setChildrenFetched (true);
+
+    NetworkManager::WirelessDevice::Ptr device =
+            NetworkManager::findNetworkInterface (parentItem->devicePath().toString())
+            .objectCast<NetworkManager::WirelessDevice>();
+    NetworkManager::WirelessNetwork::Ptr network =
+            device ? device->findNetwork (parentItem->ssid().toString())
+                   : NetworkManager::WirelessNetwork::Ptr();
+    if (!network)
+        return;
+
+    QVector<NetworkItem*> items;
+    for (const NetworkManager::AccessPoint::Ptr &ap : network->accessPoints())
+        items << createAccessPoint (ap, device, parentItem);
+
+    if (items.isEmpty())
+        return;
+
+    beginInsertRows (parent, 0, items.count() - 1);
+    parentItem->insertChildren (0, items);
+    endInsertRows ();
+}
+
+
 /* Insert number of rows below specified position */
 bool NetworkModel::insertRows (int position, int rows,
                                 const QModelIndex &parent)
@@ -292,6 +428,8 @@ bool NetworkModel::removeRows (int position, int rows,
     if (!parentItem)
         return false;
 
+    unindexItems (parentItem, position, rows);
+
     beginRemoveRows (parent, position, position + rows - 1);
     const bool success = parentItem->removeChildren (position, rows);
     endRemoveRows ();
@@ -318,9 +456,48 @@ Qt::ItemFlags NetworkModel::flags (const QModelIndex &index) const
 }
 
 
+/* Sort networks by the values shown in a column
+** Parameters:
+**     column: column to sort by, -1 keeps the current order
+**     order: ascending or descending
+*/
 void NetworkModel::sort (int column, Qt::SortOrder order)
 {
+    if (column < 0 || column >= columnRoles.count())
+    {
+        m_sortColumn = -1;
+        return;
+    }
+
+    m_sortColumn = column;
+    m_sortOrder = order;
+
+    Q_EMIT layoutAboutToBeChanged ({}, QAbstractItemModel::VerticalSortHint);
+
+    // Remember which item every persistent index points to
+    const QModelIndexList oldIndexes = persistentIndexList();
+
+    // Compute every key once instead of on each comparison
+    for (int i = 0; i < rootItem->childCount(); ++i)
+    {
+        NetworkItem *item = rootItem->child (i);
+        item->setSortKey (sortKey (item));
+    }
+    rootItem->sortChildren ([this](const NetworkItem *left, const NetworkItem *right)
+                            {
+                                return lessThan (left, right);
+                            });
+
+    QModelIndexList newIndexes;
+    newIndexes.reserve (oldIndexes.count());
+    for (const QModelIndex &index : oldIndexes)
+    {
+        NetworkItem *item = static_cast<NetworkItem*>(index.internalPointer());
+        newIndexes << createIndex (item->childNumber(), index.column(), item);
+    }
+    changePersistentIndexList (oldIndexes, newIndexes);
 
+    Q_EMIT layoutChanged ({}, QAbstractItemModel::VerticalSortHint);
 }
 
 
@@ -343,11 +520,13 @@ QHash<int, QByteArray> NetworkModel::roleNames (void) const
     roles[DevicePathRole] = "DevicePath";
     roles[DeviceStateRole] = "DeviceState";
     roles[DuplicateRole] = "Duplicate";
+    roles[FrequencyRole] = "Frequency";
     roles[HeaderRole] = "Header";
     roles[ItemUniqueNameRole] = "ItemUniqueName";
     roles[ItemTypeRole] = "ItemType";
     roles[NameRole] = "Name";
     roles[SectionRole] = "Section";
+    roles[SignalRole] = "Signal";
     roles[SlaveRole] = "Slave";
     roles[SsidRole] = "Ssid";
     roles[SpecificPathRole] = "SpecificPath";
@@ -378,34 +557,147 @@ void NetworkModel::addDevice (const NetworkManager::Device::Ptr &device,
         NetworkManager::WirelessDevice::Ptr wifiDev =
                 device.objectCast<NetworkManager::WirelessDevice>();
 
+        WirelessNetworkList networks;
         for (const NetworkManager::WirelessNetwork::Ptr &wifiNetwork :
              wifiDev->networks())
         {
-            addWirelessNetwork (wifiNetwork, wifiDev);
+            networks << qMakePair (wifiNetwork, wifiDev);
         }
+        addWirelessNetworks (networks);
     }
 
 }
 
 
-/* Adds new network
+/* Adds new networks with a single row insertion
+** Parameters:
+**     networks: the new networks and the wifi adapters seeing them
+*/
+void NetworkModel::addWirelessNetworks (const WirelessNetworkList &networks)
+{
+    QVector<NetworkItem*> items;
+    items.reserve (networks.count());
+    for (const auto &network : networks)
+    {
+        // Skip duplicates, also within the batch
+        if (m_ssidIndex.contains (network.first->ssid()))
+            continue;
+
+        NetworkItem *item = createWirelessNetwork (network.first, network.second);
+        items << item;
+        indexNetwork (item, network.first);
+    }
+
+    if (items.isEmpty())
+        return;
+
+    if (m_sortColumn < 0)
+    {
+        // Insert new rows at end of table
+        const int first = rootItem->childCount();
+        beginInsertRows (QModelIndex(), first, first + items.count() - 1);
+        rootItem->insertChildren (first, items);
+        endInsertRows ();
+        return;
+    }
+
+    // Insert new rows at their sorted position, new rows going
+    // to the same place are inserted together
+    std::stable_sort (items.begin(), items.end(),
+                      [this](const NetworkItem *left, const NetworkItem *right)
+                      {
+                          return lessThan (left, right);
+                      });
+    QVector<int> positions;
+    positions.reserve (items.count());
+    for (const NetworkItem *item : std::as_const(items))
+        positions << sortedPosition (item);
+
+    // From the bottom, so the positions above stay valid
+    int end = items.count();
+    while (end > 0)
+    {
+        const int position = positions.at(end - 1);
+        int begin = end - 1;
+        while (begin > 0 && positions.at(begin - 1) == position)
+            --begin;
+
+        beginInsertRows (QModelIndex(), position, position + end - begin - 1);
+        rootItem->insertChildren (position, items.mid (begin, end - begin));
+        endInsertRows ();
+        end = begin;
+    }
+}
+
+
+/* Create the row of a new network, filled before it is inserted
 ** Parameters:
 **     network: the new network to be added
 **     device: name of the physical wifi adapter
+** Return: the item, not yet part of the model
 */
-void NetworkModel::addWirelessNetwork (const NetworkManager::WirelessNetwork::Ptr &network,
-                                       const NetworkManager::WirelessDevice::Ptr &device)
+NetworkItem *NetworkModel::createWirelessNetwork (const NetworkManager::WirelessNetwork::Ptr &network,
+                                                  const NetworkManager::WirelessDevice::Ptr &device)
 {
-    d_ptr->initializeSignals (network);
+    d_ptr->initializeSignals (network, this);
+
+    NetworkItem *item = new NetworkItem (rootItem);
+
+    // Fill Network Item with wifi info
+    updateWirelessNetwork (item, network, device);
+    item->setSortKey (sortKey (item));
+
+    // Nothing to notify about a row the view has not seen yet
+    item->clearChangedRoles();
+
+    return item;
+}
+
+
+/* Fill network item with the current wifi info
+** Parameters:
+**     item: row holding the network
+**     network: network shown in the row
+**     device: name of the physical wifi adapter
+*/
+void NetworkModel::updateWirelessNetwork (NetworkItem *item,
+                                          const NetworkManager::WirelessNetwork::Ptr &network,
+                                          const NetworkManager::WirelessDevice::Ptr &device)
+{
+    NetworkManager::AccessPoint::Ptr ap = network->referenceAccessPoint();
+
+    if (device->ipInterfaceName().isEmpty()) {
+        item->setDeviceName (device->interfaceName());
+    }
+    else
+    {
+        item->setDeviceName (device->ipInterfaceName());
+    }
+    item->setName (network->ssid());
+    item->setSsid (network->ssid());
+    item->setDevicePath (device->uni());
+    item->setSpecificPath (ap ? ap->uni() : QString());
+    item->setType (NetworkManager::ConnectionSettings::Wireless);
+    item->setSecurityType (securityType (ap, device));
+    item->setSignalStrength (network->signalStrength());
+    item->setFrequency (ap ? ap->frequency() : 0);
+}
+
 
+/* Security of an access point as seen by a device
+** Parameters:
+**     ap: the access point, may be null
+**     device: name of the physical wifi adapter
+** Return: best security the device can use
+*/
+NetworkManager::WirelessSecurityType NetworkModel::securityType (const NetworkManager::AccessPoint::Ptr &ap,
+                                                                 const NetworkManager::WirelessDevice::Ptr &device) const
+{
     // Set default security info
-    NetworkManager::WirelessSetting::NetworkMode mode =
-            NetworkManager::WirelessSetting::Infrastructure;
     NetworkManager::WirelessSecurityType securityType =
             NetworkManager::UnknownSecurity;
 
     // Look for security info
-    NetworkManager::AccessPoint::Ptr ap = network->referenceAccessPoint();
     if (ap && (ap->capabilities().testFlag(NetworkManager::AccessPoint::Privacy)
         || ap->wpaFlags() || ap->rsnFlags()))
     {
@@ -418,35 +710,35 @@ void NetworkModel::addWirelessNetwork (const NetworkManager::WirelessNetwork::Pt
                  ap->rsnFlags());
     }
 
-    // Insert new row at end of table
-    const int index = rootItem->childCount();
-    beginInsertRows (QModelIndex(), index, index);
-    rootItem->insertChildren (rootItem->childCount(), 1, rootItem->columnCount());
-    endInsertRows ();
+    return securityType;
+}
 
-    // Fill Network Item with wifi info
-    NetworkItem *item = rootItem->child (rootItem->childCount()-1);
-    if (device->ipInterfaceName().isEmpty()) {
-        item->setDeviceName (device->interfaceName());
-    }
-    else
-    {
-        item->setDeviceName (device->ipInterfaceName());
-    }
-    item->setName (network->ssid());
-    item->setSsid (network->ssid());
-    item->setDevicePath (device->uni());
-    item->setSpecificPath (network->referenceAccessPoint()->uni());
-    item->setType (NetworkManager::ConnectionSettings::Wireless);
-    item->setSecurityType (securityType);
 
+/* Return the index of the first column of an item */
+QModelIndex NetworkModel::indexForItem (NetworkItem *item) const
+{
+    if (!item || item == rootItem)
+        return QModelIndex();
 
-    // Set column role
-    int row = rootItem->childCount()-1;
-    for (int i=0; i < columnRoles.count(); ++i)
-    {
-        setData (this->index(row,i), columnRoles.at(i));
-    }
+    return createIndex (item->childNumber(), 0, item);
+}
+
+
+/* Find the row showing a network
+** Parameters:
+**     network: network sending a change
+** Return: the row, or nullptr if the network is shown for another device
+*/
+NetworkItem *NetworkModel::itemForNetwork (const NetworkManager::WirelessNetwork *network) const
+{
+    if (!network)
+        return nullptr;
+
+    NetworkItem *item = m_ssidIndex.value (network->ssid());
+    if (!item || item->devicePath().toString() != network->device())
+        return nullptr;
+
+    return item;
 }
 
 
@@ -472,16 +764,587 @@ void NetworkModel::wirelessNetworkAppeared (const QString &ssid)
         // Find the network with the specific ssid
         NetworkManager::WirelessNetwork::Ptr network =
                 wirelessDevice->findNetwork (ssid);
+        if (!network)
+            return;
 
         // Look for duplicates
-        QString ssid = network->ssid();
-        for (int i = 0; i < rootItem->childCount(); ++i)
+        NetworkItem *item = m_ssidIndex.value (network->ssid());
+        if (item)
+        {
+            // The network came back before its removal was applied
+            m_vanishedNetworks.remove (network->ssid());
+
+            // Access points of a known network may still be new
+            indexNetwork (item, network);
+            if (item->devicePath().toString() == wirelessDevice->uni())
+            {
+                d_ptr->initializeSignals (network, this);
+                updateWirelessNetwork (item, network, wirelessDevice);
+                itemChanged (item);
+            }
+            return;
+        }
+
+        // Add new network with the next batch
+        if (!m_appearedNetworks.contains (network->ssid()))
+        {
+            m_appearedNetworks.insert (network->ssid(), wirelessDevice->uni());
+            if (!m_updateTimer->isActive())
+                m_updateTimer->start();
+        }
+    }
+}
+
+
+/* Triggers when a network is no longer seen by a device
+** Parameters:
+**     ssid: takes a network name
+*/
+void NetworkModel::wirelessNetworkDisappeared (const QString &ssid)
+{
+    const auto device = qobject_cast<NetworkManager::Device *>(sender());
+    if (device && m_appearedNetworks.value (ssid) == device->uni())
+        m_appearedNetworks.remove (ssid);
+
+    if (!m_ssidIndex.contains (ssid))
+        return;
+
+    m_vanishedNetworks.insert (ssid);
+    if (!m_updateTimer->isActive())
+        m_updateTimer->start();
+}
+
+
+/* Triggers when the strongest access point of a network changes
+** Parameters:
+**     accessPoint: path of the new reference access point
+*/
+void NetworkModel::wirelessNetworkReferenceApChanged (const QString &accessPoint)
+{
+    Q_UNUSED(accessPoint);
+
+    const auto network = qobject_cast<NetworkManager::WirelessNetwork *>(sender());
+    NetworkItem *item = itemForNetwork (network);
+    if (!item)
+        return;
+
+    NetworkManager::WirelessDevice::Ptr device =
+            NetworkManager::findNetworkInterface (network->device())
+            .objectCast<NetworkManager::WirelessDevice>();
+    NetworkManager::WirelessNetwork::Ptr networkPtr =
+            device ? device->findNetwork (network->ssid()) : NetworkManager::WirelessNetwork::Ptr();
+    if (!networkPtr)
+        return;
+
+    indexNetwork (item, networkPtr);
+    updateWirelessNetwork (item, networkPtr, device);
+    itemChanged (item);
+}
+
+
+/* Triggers when the signal strength of a network changes
+** Parameters:
+**     strength: strength as a percentage
+*/
+void NetworkModel::wirelessNetworkSignalChanged (int strength)
+{
+    NetworkItem *item =
+            itemForNetwork (qobject_cast<NetworkManager::WirelessNetwork *>(sender()));
+    if (!item)
+        return;
+
+    item->setSignalStrength (strength);
+    itemChanged (item);
+}
+
+
+/* Access Points
+** --------
+** Rows below each network for its access points, created when
+** the network row is expanded and kept up to date afterwards
+** --------
+**/
+
+/* Create the row of an access point, filled before it is inserted
+** Parameters:
+**     ap: the access point
+**     device: name of the physical wifi adapter
+**     parent: row of the network the access point belongs to
+** Return: the item, not yet part of the model
+*/
+NetworkItem *NetworkModel::createAccessPoint (const NetworkManager::AccessPoint::Ptr &ap,
+                                              const NetworkManager::WirelessDevice::Ptr &device,
+                                              NetworkItem *parent)
+{
+    d_ptr->initializeSignals (ap, this);
+
+    NetworkItem *item = new NetworkItem (parent);
+
+    item->setDeviceName (parent->deviceName());
+    item->setDevicePath (device->uni());
+    item->setSsid (ap->ssid());
+    item->setSpecificPath (ap->uni());
+    item->setType (NetworkManager::ConnectionSettings::Wireless);
+    item->setSecurityType (securityType (ap, device));
+    updateAccessPoint (item, ap, device);
+    item->clearChangedRoles();
+
+    m_accessPointItems.insert (ap->uni(), item);
+
+    return item;
+}
+
+
+/* Fill access point row with the values which change over time */
+void NetworkModel::updateAccessPoint (NetworkItem *item,
+                                      const NetworkManager::AccessPoint::Ptr &ap,
+                                      const NetworkManager::WirelessDevice::Ptr &device)
+{
+    Q_UNUSED(device);
+
+    // Channel numbers of the 2.4, 5 and 6 GHz bands
+    const uint frequency = ap->frequency();
+    int channel = 0;
+    if (frequency == 2484)
+        channel = 14;
+    else if (frequency >= 2412 && frequency < 2484)
+        channel = (frequency - 2407) / 5;
+    else if (frequency >= 5000 && frequency < 5950)
+        channel = (frequency - 5000) / 5;
+    else if (frequency >= 5950)
+        channel = (frequency - 5950) / 5;
+
+    if (channel)
+        item->setName (ap->hardwareAddress() % QStringLiteral("  ch ")
+                       % QString::number (channel));
+    else
+        item->setName (ap->hardwareAddress());
+    item->setFrequency (frequency);
+    item->setSignalStrength (ap->signalStrength());
+    item->setLastSeen (ap->lastSeen());
+}
+
+
+/* Triggers when a device sees a new access point
+** Parameters:
+**     uni: path of the access point
+*/
+void NetworkModel::accessPointAppeared (const QString &uni)
+{
+    const auto wirelessDevice = qobject_cast<NetworkManager::WirelessDevice *>(sender());
+    if (!wirelessDevice || m_accessPointItems.contains (uni))
+        return;
+
+    NetworkManager::AccessPoint::Ptr ap = wirelessDevice->findAccessPoint (uni);
+    if (!ap)
+        return;
+
+    // Only networks whose access points were fetched show them
+    NetworkItem *parentItem = m_ssidIndex.value (ap->ssid());
+    if (!parentItem || !parentItem->childrenFetched()
+        || parentItem->devicePath().toString() != wirelessDevice->uni())
+        return;
+
+    NetworkManager::WirelessDevice::Ptr device =
+            NetworkManager::findNetworkInterface (wirelessDevice->uni())
+            .objectCast<NetworkManager::WirelessDevice>();
+    NetworkItem *item = createAccessPoint (ap, device, parentItem);
+
+    const int row = parentItem->childCount();
+    beginInsertRows (indexForItem (parentItem), row, row);
+    parentItem->insertChildren (row, {item});
+    endInsertRows ();
+}
+
+
+/* Triggers when a device no longer sees an access point
+** Parameters:
+**     uni: path of the access point
+*/
+void NetworkModel::accessPointDisappeared (const QString &uni)
+{
+    NetworkItem *item = m_accessPointItems.value (uni);
+    if (!item)
+        return;
+
+    removeRows (item->childNumber(), 1, indexForItem (item->parent()));
+}
+
+
+/* Triggers when the strength, frequency or last scan of an
+** access point changes
+*/
+void NetworkModel::accessPointChanged ()
+{
+    const auto ap = qobject_cast<NetworkManager::AccessPoint *>(sender());
+    NetworkItem *item = ap ? m_accessPointItems.value (ap->uni()) : nullptr;
+    if (!item)
+        return;
+
+    NetworkManager::WirelessDevice::Ptr device =
+            NetworkManager::findNetworkInterface (item->devicePath().toString())
+            .objectCast<NetworkManager::WirelessDevice>();
+    NetworkManager::AccessPoint::Ptr apPtr =
+            device ? device->findAccessPoint (ap->uni()) : NetworkManager::AccessPoint::Ptr();
+    if (!apPtr)
+        return;
+
+    updateAccessPoint (item, apPtr, device);
+    itemChanged (item);
+}
+
+
+/* Incremental Updates
+** --------
+** Changes to existing rows and removals are collected and
+** applied together, so the view relayouts once per batch
+** --------
+**/
+
+/* Queue a row whose roles changed */
+void NetworkModel::itemChanged (NetworkItem *item)
+{
+    if (item->changedRoles().isEmpty())
+        return;
+
+    m_changedItems.insert (item);
+    if (!m_updateTimer->isActive())
+        m_updateTimer->start();
+}
+
+
+/* Apply the queued removals, insertions and changes */
+void NetworkModel::flushUpdates ()
+{
+    removeVanishedNetworks();
+    insertAppearedNetworks();
+    emitChangedItems();
+}
+
+
+/* Remove rows of networks no device sees anymore,
+** one beginRemoveRows per contiguous range
+*/
+void NetworkModel::removeVanishedNetworks ()
+{
+    QVector<int> rows;
+    for (const QString &ssid : std::as_const(m_vanishedNetworks))
+    {
+        NetworkItem *item = m_ssidIndex.value (ssid);
+        if (!item)
+            continue;
+
+        // Another device may still see the network
+        NetworkManager::WirelessDevice::Ptr seenBy;
+        NetworkManager::WirelessNetwork::Ptr network;
+        for (const NetworkManager::Device::Ptr &device :
+             NetworkManager::networkInterfaces())
         {
-            if (rootItem->child(i)->ssid() == ssid )
-                return;
+            const auto wifiDev = device.objectCast<NetworkManager::WirelessDevice>();
+            const auto found = wifiDev ? wifiDev->findNetwork (ssid)
+                                       : NetworkManager::WirelessNetwork::Ptr();
+            if (!found)
+                continue;
+
+            seenBy = wifiDev;
+            network = found;
+            if (wifiDev->uni() == item->devicePath().toString())
+                break;
         }
 
-        // Add new network
-        addWirelessNetwork (network, wirelessDevice);
+        if (!seenBy)
+            rows << item->childNumber();
+        else if (seenBy->uni() != item->devicePath().toString())
+            moveToDevice (item, network, seenBy);
+    }
+    m_vanishedNetworks.clear();
+
+    // Remove from the bottom so the rows above keep their numbers
+    std::sort (rows.begin(), rows.end(), std::greater<int>());
+    int i = 0;
+    while (i < rows.count())
+    {
+        int first = rows.at(i);
+        int count = 1;
+        while (i + count < rows.count() && rows.at(i + count) == first - 1)
+        {
+            --first;
+            ++count;
+        }
+        removeRows (first, count);
+        i += count;
+    }
+}
+
+
+/* Show a network row for another device after the one it
+** was shown for lost the network
+** Parameters:
+**     item: row holding the network
+**     network: the network as seen by the other device
+**     device: the device still seeing the network
+*/
+void NetworkModel::moveToDevice (NetworkItem *item,
+                                 const NetworkManager::WirelessNetwork::Ptr &network,
+                                 const NetworkManager::WirelessDevice::Ptr &device)
+{
+    // Access points were fetched from the old device, fetch them again
+    if (item->childCount())
+        removeRows (0, item->childCount(), indexForItem (item));
+    item->setChildrenFetched (false);
+
+    d_ptr->initializeSignals (network, this);
+    updateWirelessNetwork (item, network, device);
+    itemChanged (item);
+}
+
+
+/* Insert the networks which appeared since the last batch,
+** usually the result of one scan
+*/
+void NetworkModel::insertAppearedNetworks ()
+{
+    WirelessNetworkList networks;
+    for (auto it = m_appearedNetworks.cbegin(); it != m_appearedNetworks.cend(); ++it)
+    {
+        NetworkManager::WirelessDevice::Ptr device =
+                NetworkManager::findNetworkInterface (it.value())
+                .objectCast<NetworkManager::WirelessDevice>();
+        NetworkManager::WirelessNetwork::Ptr network =
+                device ? device->findNetwork (it.key()) : NetworkManager::WirelessNetwork::Ptr();
+        if (network)
+            networks << qMakePair (network, device);
+    }
+    m_appearedNetworks.clear();
+
+    addWirelessNetworks (networks);
+}
+
+
+/* Emit dataChanged for changed rows, one per contiguous
+** range, with the roles that changed in it
+*/
+void NetworkModel::emitChangedItems ()
+{
+    if (m_changedItems.isEmpty())
+        return;
+
+    QVector<NetworkItem*> items (m_changedItems.cbegin(), m_changedItems.cend());
+    m_changedItems.clear();
+
+    // Keep rows whose sort key changed in place
+    if (m_sortColumn >= 0)
+    {
+        for (NetworkItem *item : std::as_const(items))
+        {
+            if (item->parent() != rootItem)
+                continue;
+
+            const NetworkItem::SortKey key = sortKey (item);
+            if (key.number != item->sortNumber() || key.text != item->sortText())
+            {
+                item->setSortKey (key);
+                moveToSortedPosition (item);
+            }
+        }
+    }
+
+    std::sort (items.begin(), items.end(),
+               [](NetworkItem *a, NetworkItem *b)
+               {
+                   if (a->parent() != b->parent())
+                       return a->parent() < b->parent();
+                   return a->childNumber() < b->childNumber();
+               });
+
+    const int lastColumn = columnCount() - 1;
+    int i = 0;
+    while (i < items.count())
+    {
+        NetworkItem *first = items.at(i);
+        NetworkItem *last = first;
+        QSet<int> roles;
+
+        // Extend the range while the rows follow each other
+        int j = i;
+        do {
+            last = items.at(j);
+            for (int role : last->changedRoles())
+                roles.insert (role);
+            last->clearChangedRoles();
+            ++j;
+        } while (j < items.count()
+                 && items.at(j)->parent() == first->parent()
+                 && items.at(j)->childNumber() == last->childNumber() + 1);
+        i = j;
+
+        // Roles are shown through the columns of the view
+        roles.insert (Qt::DisplayRole);
+        if (roles.contains (ItemRole::ConnectionIconRole)
+            || roles.contains (ItemRole::SignalRole))
+            roles.insert (Qt::DecorationRole);
+
+        const QModelIndex parent = indexForItem (first->parent());
+        Q_EMIT dataChanged (index (first->childNumber(), 0, parent),
+                            index (last->childNumber(), lastColumn, parent),
+                            QVector<int> (roles.cbegin(), roles.cend()));
+    }
+}
+
+
+/* Sorting
+** --------
+** Rows are ordered by a key cached in each item, so
+** comparisons never go through data() and QVariant
+** --------
+**/
+
+/* Compute the sort key of an item for the sort column */
+NetworkItem::SortKey NetworkModel::sortKey (const NetworkItem *item) const
+{
+    NetworkItem::SortKey key;
+    if (m_sortColumn < 0)
+        return key;
+
+    switch (columnRoles.at(m_sortColumn)) {
+    case ConnectionStateRole:
+        key.number = item->connectionState();
+        break;
+    case DeviceName:
+        key.text = item->deviceName().toString().toCaseFolded();
+        break;
+    case DevicePathRole:
+        key.text = item->devicePath().toString();
+        break;
+    case NameRole:
+        key.text = item->name().toCaseFolded();
+        break;
+    case SecurityTypeRole:
+        key.number = item->securityType();
+        break;
+    case SignalRole:
+        key.number = item->signalStrength();
+        break;
+    case SpecificPathRole:
+        key.text = item->specificPath().toString();
+        break;
+    case SsidRole:
+        key.text = item->ssid().toString().toCaseFolded();
+        break;
+    case TypeRole:
+        key.number = item->type();
+        break;
+    case UuidRole:
+        key.text = item->uuid().toString();
+        break;
+    default:
+        break;
+    }
+
+    return key;
+}
+
+
+/* Compare cached sort keys in the current sort order */
+bool NetworkModel::lessThan (const NetworkItem *left, const NetworkItem *right) const
+{
+    if (m_sortOrder == Qt::DescendingOrder)
+        std::swap (left, right);
+
+    if (left->sortNumber() != right->sortNumber())
+        return left->sortNumber() < right->sortNumber();
+    return left->sortText() < right->sortText();
+}
+
+
+/* Find the row an item belongs to, after the equal ones
+** Parameters:
+**     item: the item to place
+**     skipRow: row to leave out, the current row of the item
+** Return: the row counted without skipRow
+*/
+int NetworkModel::sortedPosition (const NetworkItem *item, int skipRow) const
+{
+    int count = rootItem->childCount() - (skipRow >= 0 ? 1 : 0);
+    int first = 0;
+    while (count > 0)
+    {
+        const int step = count / 2;
+        const int middle = first + step;
+        const int row = (skipRow >= 0 && middle >= skipRow) ? middle + 1 : middle;
+
+        if (!lessThan (item, rootItem->child (row)))
+        {
+            first = middle + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+
+/* Move a row whose sort key changed to its sorted position */
+void NetworkModel::moveToSortedPosition (NetworkItem *item)
+{
+    const int from = item->childNumber();
+    const int to = sortedPosition (item, from);
+    if (to == from)
+        return;
+
+    // beginMoveRows counts the destination before the row is taken out
+    beginMoveRows (QModelIndex(), from, from, QModelIndex(), to > from ? to + 1 : to);
+    rootItem->moveChild (from, to);
+    endMoveRows ();
+}
+
+
+/* Network Index
+** --------
+** Look up network rows by ssid without scanning every row,
+** access point rows are found by path in m_accessPointItems
+** --------
+**/
+
+/* Add network to the index
+** Parameters:
+**     item: row holding the network
+**     network: network to index
+*/
+void NetworkModel::indexNetwork (NetworkItem *item,
+                                 const NetworkManager::WirelessNetwork::Ptr &network)
+{
+    m_ssidIndex.insert (network->ssid(), item);
+}
+
+
+/* Remove rows from the index before they get deleted
+** Parameters:
+**     parent: item holding the rows
+**     position: first row
+**     rows: number of rows
+*/
+void NetworkModel::unindexItems (NetworkItem *parent, int position, int rows)
+{
+    for (int i = position; i < position + rows; ++i)
+    {
+        NetworkItem *item = parent->child (i);
+        if (!item)
+            continue;
+
+        m_changedItems.remove (item);
+        const QString ssid = item->ssid().toString();
+        if (m_ssidIndex.value (ssid) == item)
+            m_ssidIndex.remove (ssid);
+
+        // access point rows go away with their network
+        const QString uni = item->specificPath().toString();
+        if (m_accessPointItems.value (uni) == item)
+            m_accessPointItems.remove (uni);
+        if (item->childCount())
+            unindexItems (item, 0, item->childCount());
     }
 }
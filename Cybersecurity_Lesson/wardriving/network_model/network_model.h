@@ -2,6 +2,8 @@
 #define NetworkModel_H
 
 #include <QAbstractItemModel>
+#include <QHash>
+#include <QSet>
 #include <QTimer>
 
 #include <NetworkManagerQt/WirelessDevice>
@@ -25,6 +27,8 @@ public:
 
     /* Tree Model */
     QVariant data (const QModelIndex &index, int role) const override;
+    void multiData (const QModelIndex &index,
+                    QModelRoleDataSpan roleDataSpan) const override;
     bool setData (const QModelIndex &index, const QVariant &network_role,
                   int role = Qt::EditRole) override;
 
@@ -38,6 +42,10 @@ public:
     QModelIndex parent (const QModelIndex &index) const override;
 
     int rowCount (const QModelIndex &parent = QModelIndex()) const override;
+    bool hasChildren (const QModelIndex &parent = QModelIndex()) const override;
+
+    bool canFetchMore (const QModelIndex &parent) const override;
+    void fetchMore (const QModelIndex &parent) override;
 
     bool insertRows (int position, int rows,
                      const QModelIndex &parent = QModelIndex()) override;
@@ -57,24 +65,81 @@ public:
 
 private Q_SLOTS:
     void wirelessNetworkAppeared (const QString &ssid);
+    void wirelessNetworkDisappeared (const QString &ssid);
+    void wirelessNetworkReferenceApChanged (const QString &accessPoint);
+    void wirelessNetworkSignalChanged (int strength);
+    void accessPointAppeared (const QString &uni);
+    void accessPointDisappeared (const QString &uni);
+    void accessPointChanged ();
 
 private:
     /* Tree Model */
     NetworkItem *rootItem;
     QVector<ItemRole> columnRoles;
+    // values shared by every index
+    QVariant m_foregroundColor;
+    QVariant decoration (const NetworkItem *item, int column) const;
     void setupModelData (const QVector<ItemRole> &roles, NetworkItem *parent);
 
     /* Network Model */
     void addConnection (const NetworkManager::Connection::Ptr &connection,
                         QVector<ItemRole> &list);
     void addDevice (const NetworkManager::Device::Ptr &device, NetworkItem *parent);
-    void addWirelessNetwork (const NetworkManager::WirelessNetwork::Ptr &network,
-                             const NetworkManager::WirelessDevice::Ptr &device);
+    using WirelessNetworkList =
+        QVector<QPair<NetworkManager::WirelessNetwork::Ptr,
+                      NetworkManager::WirelessDevice::Ptr>>;
+    void addWirelessNetworks (const WirelessNetworkList &networks);
+    NetworkItem *createWirelessNetwork (const NetworkManager::WirelessNetwork::Ptr &network,
+                                        const NetworkManager::WirelessDevice::Ptr &device);
+    void updateWirelessNetwork (NetworkItem *item,
+                                const NetworkManager::WirelessNetwork::Ptr &network,
+                                const NetworkManager::WirelessDevice::Ptr &device);
+    NetworkItem *itemForNetwork (const NetworkManager::WirelessNetwork *network) const;
+    NetworkManager::WirelessSecurityType securityType (const NetworkManager::AccessPoint::Ptr &ap,
+                                                      const NetworkManager::WirelessDevice::Ptr &device) const;
+    QModelIndex indexForItem (NetworkItem *item) const;
+
+    /* Access Points */
+    QHash<QString, NetworkItem*> m_accessPointItems;
+    NetworkItem *createAccessPoint (const NetworkManager::AccessPoint::Ptr &ap,
+                                    const NetworkManager::WirelessDevice::Ptr &device,
+                                    NetworkItem *parent);
+    void updateAccessPoint (NetworkItem *item,
+                            const NetworkManager::AccessPoint::Ptr &ap,
+                            const NetworkManager::WirelessDevice::Ptr &device);
+
+    /* Network Index */
+    QHash<QString, NetworkItem*> m_ssidIndex;
+    void indexNetwork (NetworkItem *item,
+                       const NetworkManager::WirelessNetwork::Ptr &network);
+    void unindexItems (NetworkItem *parent, int position, int rows);
 
     /* Scan Networks */
     NetworkScan *m_scanHandler;
     QTimer *m_timer = nullptr;
 
+    /* Incremental Updates */
+    QSet<NetworkItem*> m_changedItems;
+    QSet<QString> m_vanishedNetworks;
+    QHash<QString, QString> m_appearedNetworks;
+    QTimer *m_updateTimer = nullptr;
+    void itemChanged (NetworkItem *item);
+    void flushUpdates ();
+    void removeVanishedNetworks ();
+    void moveToDevice (NetworkItem *item,
+                       const NetworkManager::WirelessNetwork::Ptr &network,
+                       const NetworkManager::WirelessDevice::Ptr &device);
+    void insertAppearedNetworks ();
+    void emitChangedItems ();
+
+    /* Sorting */
+    int m_sortColumn = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+    NetworkItem::SortKey sortKey (const NetworkItem *item) const;
+    bool lessThan (const NetworkItem *left, const NetworkItem *right) const;
+    int sortedPosition (const NetworkItem *item, int skipRow = -1) const;
+    void moveToSortedPosition (NetworkItem *item);
+
 protected:
     NetworkModel (NetworkModelPrivate &dd);
     NetworkModelPrivate *d_ptr;
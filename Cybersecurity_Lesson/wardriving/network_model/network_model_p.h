@@ -39,7 +39,7 @@ public:
             break;
 
         case ConnectionIconRole:
-            return QIcon (item->icon());
+            return NetworkIcons::icon (item->iconState());
             break;
 
         case NameRole:
@@ -54,6 +54,10 @@ public:
             return getSecurityString(item->securityType());
             break;
 
+        case SignalRole:
+            return item->signalStrength();
+            break;
+
         case SsidRole:
             return item->ssid();
             break;
@@ -68,54 +72,9 @@ public:
     }
 
 
-    QString getSecurityString (NetworkManager::WirelessSecurityType type) const
+    const QString &getSecurityString (NetworkManager::WirelessSecurityType type) const
     {
-        switch (type) {
-        case NetworkManager::NoneSecurity:
-            return QStringLiteral("None");
-            break;
-
-        case NetworkManager::StaticWep:
-            return QStringLiteral("Static-Wep");
-            break;
-
-        case NetworkManager::DynamicWep:
-            return QStringLiteral("Dynamic-Wep");
-            break;
-
-        case NetworkManager::Leap:
-            return QStringLiteral("Leap");
-            break;
-
-        case NetworkManager::WpaPsk:
-            return QStringLiteral("Wpa-Psk");
-            break;
-
-        case NetworkManager::WpaEap:
-            return QStringLiteral("Wpa-Eap");
-            break;
-
-        case NetworkManager::Wpa2Psk:
-            return QStringLiteral("Wpa2-Psk");
-            break;
-
-        case NetworkManager::Wpa2Eap:
-            return QStringLiteral("Wpa2-Eap");
-            break;
-
-        case NetworkManager::SAE:
-            return QStringLiteral("SAE");
-            break;
-
-        case NetworkManager::Wpa3SuiteB192:
-            return QStringLiteral("Wpa3-Suite-B192");
-            break;
-
-        default:
-            return QStringLiteral("Unknown");
-        }
-
-        return QStringLiteral("error");
+        return NetworkItem::securityString (type);
     }
 
 
@@ -150,6 +109,10 @@ public:
             item->insertRole (ItemRole::SecurityTypeRole);
             break;
 
+        case ItemRole::SignalRole:
+            item->insertRole (ItemRole::SignalRole);
+            break;
+
         case ItemRole::SsidRole:
             item->insertRole (ItemRole::SsidRole);
             break;
@@ -198,16 +161,63 @@ public:
                          dd,
                          &NetworkModel::wirelessNetworkAppeared,
                          Qt::UniqueConnection);
+
+            dd->connect (wifiDev.data(),
+                         &NetworkManager::WirelessDevice::networkDisappeared,
+                         dd,
+                         &NetworkModel::wirelessNetworkDisappeared,
+                         Qt::UniqueConnection);
+
+            dd->connect (wifiDev.data(),
+                         &NetworkManager::WirelessDevice::accessPointAppeared,
+                         dd,
+                         &NetworkModel::accessPointAppeared,
+                         Qt::UniqueConnection);
+
+            dd->connect (wifiDev.data(),
+                         &NetworkManager::WirelessDevice::accessPointDisappeared,
+                         dd,
+                         &NetworkModel::accessPointDisappeared,
+                         Qt::UniqueConnection);
         }
     }
 
-    void initializeSignals(const NetworkManager::WirelessNetwork::Ptr &network) const
+    void initializeSignals (const NetworkManager::AccessPoint::Ptr &ap,
+                            NetworkModel *dd) const
+    {
+        dd->connect (ap.data(),
+                     &NetworkManager::AccessPoint::signalStrengthChanged,
+                     dd,
+                     &NetworkModel::accessPointChanged,
+                     Qt::UniqueConnection);
+
+        dd->connect (ap.data(),
+                     &NetworkManager::AccessPoint::lastSeenChanged,
+                     dd,
+                     &NetworkModel::accessPointChanged,
+                     Qt::UniqueConnection);
+
+        dd->connect (ap.data(),
+                     &NetworkManager::AccessPoint::frequencyChanged,
+                     dd,
+                     &NetworkModel::accessPointChanged,
+                     Qt::UniqueConnection);
+    }
+
+    void initializeSignals (const NetworkManager::WirelessNetwork::Ptr &network,
+                            NetworkModel *dd) const
     {
-    //    connect(network.data(),
-    //            &NetworkManager::WirelessNetwork::referenceAccessPointChanged,
-    //            this,
-    //            &NetworkModel::wirelessNetworkReferenceApChanged,
-    //            Qt::UniqueConnection);
+        dd->connect (network.data(),
+                     &NetworkManager::WirelessNetwork::referenceAccessPointChanged,
+                     dd,
+                     &NetworkModel::wirelessNetworkReferenceApChanged,
+                     Qt::UniqueConnection);
+
+        dd->connect (network.data(),
+                     &NetworkManager::WirelessNetwork::signalStrengthChanged,
+                     dd,
+                     &NetworkModel::wirelessNetworkSignalChanged,
+                     Qt::UniqueConnection);
     }
 };
 
@@ -23,6 +23,16 @@ void NetworkScan::updateConnection (const NetworkManager::Connection::Ptr &conne
     watcher->setProperty("connection", connection->name());
 }
 
+/* only the settings that differ from the stored profile are replaced */
+void NetworkScan::updateConnection (const NetworkManager::Connection::Ptr &connection,
+                                    const NetworkManager::ConnectionSettings::Ptr &settings)
+{
+    QDBusPendingReply<QVariantMap> reply = connection->updateChanged (settings);
+    auto watcher = new QDBusPendingCallWatcher(reply, this);
+    watcher->setProperty("action", HandlerAction::UpdateConnection);
+    watcher->setProperty("connection", connection->name());
+}
+
 
 void NetworkScan::requestScan (const QString &interface)
 {
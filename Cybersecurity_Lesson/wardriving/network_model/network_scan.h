@@ -17,6 +17,8 @@ public:
 public Q_SLOTS:
     void updateConnection (const NetworkManager::Connection::Ptr &connection,
                            const NMVariantMapMap &map);
+    void updateConnection (const NetworkManager::Connection::Ptr &connection,
+                           const NetworkManager::ConnectionSettings::Ptr &settings);
     void requestScan (const QString &interface  = QString());
 
 private:
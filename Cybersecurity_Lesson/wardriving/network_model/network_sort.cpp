@@ -1,7 +1,337 @@
+/* Network Sort Filter
+** File: network_sort.cpp
+** --------
+** Filter networks of the NetworkModel by security, band,
+** signal and ssid
+** --------
+*/
+
+/* Qt include files */
+#include <QtMath>
+
+/* local include files */
 #include "network_sort.h"
+#include "network_item.h"
+#include "network_model.h"
 
 NetworkSortFilter::NetworkSortFilter (QObject *parent)
     : QSortFilterProxyModel{parent}
 {
+    m_ssidMatcher.setCaseSensitivity (Qt::CaseInsensitive);
+}
+
+
+/* Set the model to filter
+** Parameters:
+**     sourceModel: model to filter, only a NetworkModel gets filtered
+*/
+void NetworkSortFilter::setSourceModel (QAbstractItemModel *sourceModel)
+{
+    for (const QMetaObject::Connection &connection : std::as_const(m_sourceConnections))
+        disconnect (connection);
+    m_sourceConnections.clear();
+    m_results.clear();
+    m_networkSource = qobject_cast<NetworkModel*>(sourceModel);
+
+    // Connected before the proxy itself, so cached results are
+    // dropped before the proxy filters changed or removed rows
+    if (m_networkSource)
+    {
+        m_sourceConnections << connect (sourceModel, &QAbstractItemModel::dataChanged, this,
+                 [this](const QModelIndex &topLeft, const QModelIndex &bottomRight)
+                 {
+                     forgetResults (topLeft.parent(), topLeft.row(), bottomRight.row(), false);
+                 });
+        m_sourceConnections << connect (sourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+                 [this](const QModelIndex &parent, int first, int last)
+                 {
+                     forgetResults (parent, first, last, true);
+                 });
+        m_sourceConnections << connect (sourceModel, &QAbstractItemModel::modelAboutToBeReset, this,
+                 [this]()
+                 {
+                     m_results.clear();
+                 });
+    }
+
+    QSortFilterProxyModel::setSourceModel (sourceModel);
+}
+
+
+/* NetworkModel sorts itself with cached keys, the proxy
+** keeps its order instead of comparing data() values
+*/
+void NetworkSortFilter::sort (int column, Qt::SortOrder order)
+{
+    if (m_networkSource)
+    {
+        sourceModel()->sort (column, order);
+        return;
+    }
+
+    QSortFilterProxyModel::sort (column, order);
+}
+
+
+/* Filter terms
+** --------
+** Every setter compiles its term once, filterAcceptsRow only
+** compares typed NetworkItem fields against the result
+** --------
+**/
+
+NetworkSortFilter::SecurityClasses NetworkSortFilter::securityFilter() const
+{
+    return m_securityFilter;
+}
+
+/* Accept networks of the given security classes only
+** Parameters:
+**     classes: accepted classes, AllSecurity disables the term
+*/
+void NetworkSortFilter::setSecurityFilter (SecurityClasses classes)
+{
+    if (m_securityFilter == classes)
+        return;
+    m_securityFilter = classes;
+
+    const QVector<QPair<SecurityClass, QVector<NetworkManager::WirelessSecurityType>>> types {
+        {OpenSecurity, {NetworkManager::NoneSecurity}},
+        {WepSecurity, {NetworkManager::StaticWep, NetworkManager::DynamicWep, NetworkManager::Leap}},
+        {PersonalSecurity, {NetworkManager::WpaPsk, NetworkManager::Wpa2Psk}},
+        {Wpa3Security, {NetworkManager::SAE}},
+        {EnterpriseSecurity, {NetworkManager::WpaEap, NetworkManager::Wpa2Eap, NetworkManager::Wpa3SuiteB192}},
+        {UnknownSecurityClass, {NetworkManager::UnknownSecurity}},
+    };
+
+    m_securityMask = 0;
+    for (const auto &securityClass : types)
+    {
+        if (!classes.testFlag (securityClass.first))
+            continue;
+        for (NetworkManager::WirelessSecurityType type : securityClass.second)
+            m_securityMask |= 1u << (type + 1);
+    }
+
+    termChanged (SecurityTerm, (classes & AllSecurity) != AllSecurity);
+}
+
+
+NetworkSortFilter::Bands NetworkSortFilter::bandFilter() const
+{
+    return m_bandFilter;
+}
+
+/* Accept networks on the given bands only
+** Parameters:
+**     bands: accepted bands, AllBands disables the term
+*/
+void NetworkSortFilter::setBandFilter (Bands bands)
+{
+    if (m_bandFilter == bands)
+        return;
+    m_bandFilter = bands;
+
+    termChanged (BandTerm, (bands & AllBands) != AllBands);
+}
+
+
+int NetworkSortFilter::minimumSignal() const
+{
+    return m_minimumSignal;
+}
+
+/* Accept networks with a stronger signal only
+** Parameters:
+**     dBm: weakest accepted signal, NoMinimumSignal disables the term
+*/
+void NetworkSortFilter::setMinimumSignal (int dBm)
+{
+    if (m_minimumSignal == dBm)
+        return;
+    m_minimumSignal = dBm;
+
+    // NetworkManager reports the strength in percent, mapping
+    // -100 dBm to 0% and -40 dBm to 100%
+    const int level = qBound (-100, dBm, -40);
+    m_minimumStrength = qCeil (100.0 - (-40 - level) * 100.0 / 60.0);
+
+    termChanged (SignalTerm, dBm > -100);
+}
+
+
+QString NetworkSortFilter::ssidFilter() const
+{
+    return m_ssidFilter;
+}
+
+bool NetworkSortFilter::ssidFilterIsRegularExpression() const
+{
+    return m_ssidRegularExpression;
+}
+
+/* Accept networks whose ssid contains a text or matches a pattern
+** Parameters:
+**     pattern: case insensitive text or pattern, empty disables the term
+**     regularExpression: whether pattern is a regular expression
+*/
+void NetworkSortFilter::setSsidFilter (const QString &pattern, bool regularExpression)
+{
+    if (m_ssidFilter == pattern && m_ssidRegularExpression == regularExpression)
+        return;
+    m_ssidFilter = pattern;
+    m_ssidRegularExpression = regularExpression;
+
+    // An invalid pattern doesn't filter anything, the error
+    // is reported through filterError() instead
+    bool valid = true;
+    if (regularExpression)
+    {
+        m_ssidExpression.setPattern (pattern);
+        m_ssidExpression.setPatternOptions (QRegularExpression::CaseInsensitiveOption);
+        m_ssidExpression.optimize();
+        valid = m_ssidExpression.isValid();
+        setFilterError (valid ? QString()
+                              : tr("Invalid ssid filter: %1").arg (m_ssidExpression.errorString()));
+    }
+    else
+    {
+        m_ssidMatcher.setPattern (pattern);
+        setFilterError (QString());
+    }
+
+    termChanged (SsidTerm, valid && !pattern.isEmpty());
+}
+
+
+QString NetworkSortFilter::filterError() const
+{
+    return m_filterError;
+}
+
+/* Report a changed filter error
+** Parameters:
+**     error: description of the error, empty if there is none
+*/
+void NetworkSortFilter::setFilterError (const QString &error)
+{
+    if (m_filterError == error)
+        return;
+    m_filterError = error;
+
+    Q_EMIT filterErrorChanged (m_filterError);
+}
+
+
+/* Decide whether a source row is shown
+** Parameters:
+**     sourceRow: row in the source model
+**     sourceParent: parent of the row in the source model
+** Return: whether the row passes every active term
+*/
+bool NetworkSortFilter::filterAcceptsRow (int sourceRow, const QModelIndex &sourceParent) const
+{
+    if (!m_networkSource)
+        return QSortFilterProxyModel::filterAcceptsRow (sourceRow, sourceParent);
+
+    // Access points below a network follow their network
+    if (sourceParent.isValid() || !m_activeTerms)
+        return true;
+
+    const QModelIndex index = sourceModel()->index (sourceRow, 0, sourceParent);
+    const NetworkItem *item = static_cast<const NetworkItem*>(index.internalPointer());
+    if (!item)
+        return true;
+
+    TermResults &results = m_results[item];
+    for (int term = 0; term < TermCount; ++term)
+    {
+        const quint8 bit = 1 << term;
+        if (!(m_activeTerms & bit))
+            continue;
+
+        if (!(results.valid & bit))
+        {
+            results.valid |= bit;
+            if (evaluate (Term (term), item))
+                results.passed |= bit;
+            else
+                results.passed &= ~bit;
+        }
+
+        if (!(results.passed & bit))
+            return false;
+    }
+
+    return true;
+}
+
+
+/* Evaluate one compiled term against a network */
+bool NetworkSortFilter::evaluate (Term term, const NetworkItem *item) const
+{
+    switch (term) {
+    case SecurityTerm:
+        return m_securityMask & (1u << (item->securityType() + 1));
+
+    case BandTerm: {
+        const uint frequency = item->frequency();
+        if (!frequency)
+            return false;
+        if (frequency < 3000)
+            return m_bandFilter.testFlag (Band2GHz);
+        if (frequency < 5950)
+            return m_bandFilter.testFlag (Band5GHz);
+        return m_bandFilter.testFlag (Band6GHz);
+    }
+
+    case SignalTerm:
+        return item->signalStrength() >= m_minimumStrength;
+
+    case SsidTerm:
+        if (m_ssidRegularExpression)
+            return m_ssidExpression.match (item->name()).hasMatch();
+        return m_ssidMatcher.indexIn (item->name()) >= 0;
+
+    case TermCount:
+        break;
+    }
+
+    return true;
+}
+
+
+/* Filter again after one term changed, only that term gets
+** evaluated again for every network
+*/
+void NetworkSortFilter::termChanged (Term term, bool active)
+{
+    const quint8 bit = 1 << term;
+    if (active)
+        m_activeTerms |= bit;
+    else
+        m_activeTerms &= ~bit;
+
+    for (TermResults &results : m_results)
+        results.valid &= ~bit;
+
+    invalidateRowsFilter();
+}
+
+
+/* Drop cached results of source rows which changed or go away */
+void NetworkSortFilter::forgetResults (const QModelIndex &parent, int first, int last, bool remove)
+{
+    if (parent.isValid())
+        return;
 
+    for (int row = first; row <= last; ++row)
+    {
+        const QModelIndex index = sourceModel()->index (row, 0, parent);
+        const NetworkItem *item = static_cast<const NetworkItem*>(index.internalPointer());
+        if (remove)
+            m_results.remove (item);
+        else if (m_results.contains (item))
+            m_results[item].valid = 0;
+    }
 }
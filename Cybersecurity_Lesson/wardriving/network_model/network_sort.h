@@ -1,17 +1,111 @@
 #ifndef NETWORKSORTFILTER_H
 #define NETWORKSORTFILTER_H
 
+#include <QHash>
+#include <QRegularExpression>
 #include <QSortFilterProxyModel>
+#include <QStringMatcher>
+
+class NetworkItem;
 
 class NetworkSortFilter : public QSortFilterProxyModel
 {
     Q_OBJECT
 
 public:
+    enum SecurityClass {
+        OpenSecurity = 0x01,
+        WepSecurity = 0x02,
+        PersonalSecurity = 0x04,
+        Wpa3Security = 0x08,
+        EnterpriseSecurity = 0x10,
+        UnknownSecurityClass = 0x20,
+        AllSecurity = 0x3f,
+    };
+    Q_DECLARE_FLAGS(SecurityClasses, SecurityClass)
+
+    enum Band {
+        Band2GHz = 0x01,
+        Band5GHz = 0x02,
+        Band6GHz = 0x04,
+        AllBands = 0x07,
+    };
+    Q_DECLARE_FLAGS(Bands, Band)
+
+    // signal filter value accepting every network
+    static constexpr int NoMinimumSignal = -1000;
+
     explicit NetworkSortFilter(QObject *parent = nullptr);
 
-signals:
+    void setSourceModel (QAbstractItemModel *sourceModel) override;
+    void sort (int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+    /* Filter terms, networks have to match all of them */
+    SecurityClasses securityFilter() const;
+    void setSecurityFilter (SecurityClasses classes);
+
+    Bands bandFilter() const;
+    void setBandFilter (Bands bands);
+
+    int minimumSignal() const;
+    void setMinimumSignal (int dBm);
+
+    QString ssidFilter() const;
+    bool ssidFilterIsRegularExpression() const;
+    void setSsidFilter (const QString &pattern, bool regularExpression = false);
 
+    /* Why the filter can't be applied, empty when it is fine */
+    QString filterError() const;
+
+Q_SIGNALS:
+    void filterErrorChanged (const QString &error);
+
+protected:
+    bool filterAcceptsRow (int sourceRow, const QModelIndex &sourceParent) const override;
+
+private:
+    /* Filter terms, cheapest first */
+    enum Term {
+        SecurityTerm,
+        BandTerm,
+        SignalTerm,
+        SsidTerm,
+        TermCount,
+    };
+
+    bool evaluate (Term term, const NetworkItem *item) const;
+    void termChanged (Term term, bool active);
+    void forgetResults (const QModelIndex &parent, int first, int last, bool remove);
+    void setFilterError (const QString &error);
+
+    /* Filter spec */
+    SecurityClasses m_securityFilter = AllSecurity;
+    Bands m_bandFilter = AllBands;
+    int m_minimumSignal = NoMinimumSignal;
+    QString m_ssidFilter;
+    bool m_ssidRegularExpression = false;
+
+    /* Compiled filter */
+    quint8 m_activeTerms = 0;
+    // bit n + 1 accepts NetworkManager::WirelessSecurityType n
+    quint32 m_securityMask = 0;
+    int m_minimumStrength = 0;
+    QStringMatcher m_ssidMatcher;
+    QRegularExpression m_ssidExpression;
+    QString m_filterError;
+
+    // results of every term for each network, so that changing
+    // one term only evaluates that term again
+    struct TermResults {
+        quint8 valid = 0;
+        quint8 passed = 0;
+    };
+    mutable QHash<const NetworkItem*, TermResults> m_results;
+    bool m_networkSource = false;
+    QVector<QMetaObject::Connection> m_sourceConnections;
 };
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(NetworkSortFilter::SecurityClasses)
+Q_DECLARE_OPERATORS_FOR_FLAGS(NetworkSortFilter::Bands)
+
 #endif // NETWORKSORTFILTER_H
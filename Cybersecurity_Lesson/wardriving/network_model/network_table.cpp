@@ -0,0 +1,170 @@
+/* Network Table
+** File: network_table.cpp
+** --------
+** Column storage for the fields of all network items
+** --------
+*/
+
+/* NetworkManager Include files */
+#include <NetworkManagerQt/ActiveConnection>
+#include <NetworkManagerQt/ConnectionSettings>
+#include <NetworkManagerQt/Utils>
+
+/* local include files */
+#include "network_icons.h"
+#include "network_table.h"
+
+
+/* String Pool
+** --------
+** Reference counted strings, an id is reused once the
+** last row using its string lets go of it
+** --------
+**/
+
+NetworkStringPool::NetworkStringPool ()
+{
+    m_strings << QString();
+    m_references << 1;
+}
+
+
+/* Take a reference to a string
+** Parameters:
+**     string: value to store
+** Return: id of the string, equal strings share their id
+*/
+int NetworkStringPool::intern (const QString &string)
+{
+    if (string.isEmpty())
+        return 0;
+
+    const auto it = m_ids.constFind (string);
+    if (it != m_ids.constEnd())
+    {
+        ++m_references[it.value()];
+        return it.value();
+    }
+
+    int id;
+    if (!m_freeIds.isEmpty())
+    {
+        id = m_freeIds.takeLast();
+        m_strings[id] = string;
+        m_references[id] = 1;
+    }
+    else
+    {
+        id = m_strings.size();
+        m_strings << string;
+        m_references << 1;
+    }
+    m_ids.insert (string, id);
+
+    return id;
+}
+
+
+/* Drop a reference taken by intern() */
+void NetworkStringPool::release (int id)
+{
+    if (id <= 0 || --m_references[id] > 0)
+        return;
+
+    m_ids.remove (m_strings.at(id));
+    m_strings[id] = QString();
+    m_freeIds << id;
+}
+
+
+/* Return number of distinct strings stored */
+int NetworkStringPool::count () const
+{
+    return m_ids.count();
+}
+
+
+/* Rows
+** --------
+** Every column has one entry per row, whether the row
+** is in use or waiting to be reused
+** --------
+**/
+
+/* Reserve a row, filled with the defaults of a new item
+** Return: number of the row
+*/
+int NetworkTable::allocate ()
+{
+    if (!m_freeRows.isEmpty())
+    {
+        const int row = m_freeRows.takeLast();
+        connectionState[row] = NetworkManager::ActiveConnection::Unknown;
+        securityType[row] = NetworkManager::UnknownSecurity;
+        type[row] = NetworkManager::ConnectionSettings::Unknown;
+        signalStrength[row] = 0;
+        frequency[row] = 0;
+        flags[row] = 0;
+        iconState[row] = NetworkIcons::Wired;
+        lastSeen[row] = -1;
+        sortNumber[row] = 0;
+        changedRoles[row] = 0;
+        return row;
+    }
+
+    connectionState << NetworkManager::ActiveConnection::Unknown;
+    securityType << NetworkManager::UnknownSecurity;
+    type << NetworkManager::ConnectionSettings::Unknown;
+    signalStrength << 0;
+    frequency << 0;
+    flags << 0;
+    iconState << NetworkIcons::Wired;
+    lastSeen << -1;
+
+    deviceName << 0;
+    devicePath << 0;
+    name << 0;
+    specificPath << 0;
+    ssid << 0;
+    uuid << 0;
+
+    sortNumber << 0;
+    sortText << 0;
+    changedRoles << 0;
+
+    return connectionState.size() - 1;
+}
+
+
+/* Give back a row, releasing its strings */
+void NetworkTable::release (int row)
+{
+    for (QVector<int> *column : {&deviceName, &devicePath, &name, &specificPath,
+                                 &ssid, &uuid, &sortText})
+    {
+        strings.release (column->at(row));
+        (*column)[row] = 0;
+    }
+
+    m_freeRows << row;
+}
+
+
+/* Store a string in a row
+** Parameters:
+**     column: one of the string columns
+**     row: number of the row
+**     string: new value
+** Return: whether the value changed
+*/
+bool NetworkTable::setString (QVector<int> &column, int row, const QString &string)
+{
+    const int old = column.at(row);
+    if (strings.at(old) == string)
+        return false;
+
+    column[row] = strings.intern (string);
+    strings.release (old);
+
+    return true;
+}
@@ -0,0 +1,88 @@
+#ifndef NetworkTable_H
+#define NetworkTable_H
+
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+/* Strings shared by every row of a NetworkTable, each distinct
+** value is stored once and referenced by its id. Id 0 is the
+** empty string.
+*/
+class NetworkStringPool
+{
+public:
+    NetworkStringPool();
+
+    int intern (const QString &string);
+    void release (int id);
+
+    const QString &at (int id) const
+    {
+        return m_strings.at(id);
+    }
+
+    int count() const;
+
+private:
+    QVector<QString> m_strings;
+    QVector<int> m_references;
+    QVector<int> m_freeIds;
+    QHash<QString, int> m_ids;
+};
+
+
+/* Fields of every NetworkItem of a model stored column by column,
+** an item only keeps the number of its row in here. Rows of deleted
+** items get reused.
+*/
+class NetworkTable
+{
+public:
+    int allocate();
+    void release (int row);
+
+    /* replace the string of a row, return whether it changed */
+    bool setString (QVector<int> &column, int row, const QString &string);
+
+    /* column schema shared by every row */
+    QVector<int> columnRoles;
+    QVector<QVariant> headerData;
+
+    /* Network Items */
+    QVector<qint8> connectionState;
+    QVector<qint8> securityType;
+    QVector<qint8> type;
+    QVector<qint8> signalStrength;
+    QVector<quint16> frequency;
+    QVector<quint8> flags;
+    QVector<quint8> iconState;
+    QVector<int> lastSeen;
+
+    // ids into strings
+    QVector<int> deviceName;
+    QVector<int> devicePath;
+    QVector<int> name;
+    QVector<int> specificPath;
+    QVector<int> ssid;
+    QVector<int> uuid;
+
+    /* Sorting */
+    QVector<qint64> sortNumber;
+    QVector<int> sortText;
+
+    // bit n set when ItemRole Qt::UserRole + 1 + n changed
+    QVector<quint32> changedRoles;
+
+    NetworkStringPool strings;
+
+    enum Flag {
+        ChildrenFetched = 0x01,
+    };
+
+private:
+    QVector<int> m_freeRows;
+};
+
+#endif // NetworkTable_H
@@ -0,0 +1,345 @@
+/* Network Sort Test
+** File: network_sort_test.cpp
+** --------
+** Tests of the filter terms of NetworkSortFilter and of the
+** results it keeps between filter runs
+** --------
+*/
+
+/* Qt include files */
+#include <QSignalSpy>
+#include <QTest>
+
+/* local include files */
+#include "network_model.h"
+#include "network_sort.h"
+#include "network_sort_test.h"
+
+Q_DECLARE_METATYPE(NetworkSortFilter::SecurityClasses)
+Q_DECLARE_METATYPE(NetworkSortFilter::Bands)
+
+
+/* Network item of a source row */
+static NetworkItem *itemAt (NetworkModel *model, int row)
+{
+    return static_cast<NetworkItem*>(model->index (row, 0).internalPointer());
+}
+
+
+/* Source row of the network with the given name, -1 if there is none */
+static int rowOf (NetworkModel *model, const QString &name)
+{
+    for (int row = 0; row < model->rowCount(); ++row)
+        if (itemAt (model, row)->name() == name)
+            return row;
+    return -1;
+}
+
+
+/* Add a network row to the end of the model
+** Parameters:
+**     model: model to add the row to
+**     name: ssid of the network
+**     type: security of the network
+**     frequency: frequency in MHz, 0 if unknown
+**     strength: signal strength in percent
+*/
+static void addNetwork (NetworkModel *model, const QString &name,
+                        NetworkManager::WirelessSecurityType type,
+                        uint frequency, int strength)
+{
+    const int row = model->rowCount();
+    model->insertRows (row, 1);
+
+    NetworkItem *item = itemAt (model, row);
+    item->setName (name);
+    item->setSsid (name);
+    item->setType (NetworkManager::ConnectionSettings::Wireless);
+    item->setSecurityType (type);
+    item->setFrequency (frequency);
+    item->setSignalStrength (strength);
+    item->clearChangedRoles();
+}
+
+
+/* Names of the networks the filter shows, sorted */
+static QStringList visibleNames (const NetworkSortFilter *filter)
+{
+    QStringList names;
+    for (int row = 0; row < filter->rowCount(); ++row)
+    {
+        const QModelIndex source = filter->mapToSource (filter->index (row, 0));
+        names << static_cast<const NetworkItem*>(source.internalPointer())->name();
+    }
+    names.sort();
+    return names;
+}
+
+
+void NetworkSortTest::init ()
+{
+    model = new NetworkModel ({ItemRole::NameRole, ItemRole::SecurityTypeRole});
+    addNetwork (model, QStringLiteral("Home"), NetworkManager::Wpa2Psk, 2437, 80);
+    addNetwork (model, QStringLiteral("Cafe"), NetworkManager::NoneSecurity, 5180, 45);
+    addNetwork (model, QStringLiteral("Office"), NetworkManager::Wpa2Eap, 5500, 60);
+    addNetwork (model, QStringLiteral("Lab 6E"), NetworkManager::SAE, 6115, 30);
+    addNetwork (model, QStringLiteral("Old"), NetworkManager::StaticWep, 2412, 20);
+    addNetwork (model, QStringLiteral("Mystery"), NetworkManager::UnknownSecurity, 0, 50);
+
+    filter = new NetworkSortFilter;
+    filter->setSourceModel (model);
+}
+
+
+void NetworkSortTest::cleanup ()
+{
+    delete filter;
+    delete model;
+}
+
+
+void NetworkSortTest::securityTerm_data ()
+{
+    QTest::addColumn<NetworkSortFilter::SecurityClasses>("classes");
+    QTest::addColumn<QStringList>("expected");
+
+    QTest::newRow("all") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::AllSecurity)
+                         << QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"};
+    QTest::newRow("open") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::OpenSecurity)
+                          << QStringList {"Cafe"};
+    QTest::newRow("wep") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::WepSecurity)
+                         << QStringList {"Old"};
+    QTest::newRow("personal") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::PersonalSecurity)
+                              << QStringList {"Home"};
+    QTest::newRow("wpa3") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::Wpa3Security)
+                          << QStringList {"Lab 6E"};
+    QTest::newRow("enterprise") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::EnterpriseSecurity)
+                                << QStringList {"Office"};
+    QTest::newRow("unknown") << NetworkSortFilter::SecurityClasses (NetworkSortFilter::UnknownSecurityClass)
+                             << QStringList {"Mystery"};
+    QTest::newRow("open and personal") << (NetworkSortFilter::OpenSecurity | NetworkSortFilter::PersonalSecurity)
+                                       << QStringList {"Cafe", "Home"};
+    QTest::newRow("none") << NetworkSortFilter::SecurityClasses()
+                          << QStringList();
+}
+
+void NetworkSortTest::securityTerm ()
+{
+    QFETCH(NetworkSortFilter::SecurityClasses, classes);
+    QFETCH(QStringList, expected);
+
+    filter->setSecurityFilter (classes);
+    QCOMPARE (visibleNames (filter), expected);
+}
+
+
+void NetworkSortTest::bandTerm_data ()
+{
+    QTest::addColumn<NetworkSortFilter::Bands>("bands");
+    QTest::addColumn<QStringList>("expected");
+
+    // a network of unknown frequency is on none of the bands
+    QTest::newRow("all") << NetworkSortFilter::Bands (NetworkSortFilter::AllBands)
+                         << QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"};
+    QTest::newRow("2.4 GHz") << NetworkSortFilter::Bands (NetworkSortFilter::Band2GHz)
+                             << QStringList {"Home", "Old"};
+    QTest::newRow("5 GHz") << NetworkSortFilter::Bands (NetworkSortFilter::Band5GHz)
+                           << QStringList {"Cafe", "Office"};
+    QTest::newRow("6 GHz") << NetworkSortFilter::Bands (NetworkSortFilter::Band6GHz)
+                           << QStringList {"Lab 6E"};
+    QTest::newRow("5 and 6 GHz") << (NetworkSortFilter::Band5GHz | NetworkSortFilter::Band6GHz)
+                                 << QStringList {"Cafe", "Lab 6E", "Office"};
+}
+
+void NetworkSortTest::bandTerm ()
+{
+    QFETCH(NetworkSortFilter::Bands, bands);
+    QFETCH(QStringList, expected);
+
+    filter->setBandFilter (bands);
+    QCOMPARE (visibleNames (filter), expected);
+}
+
+
+void NetworkSortTest::signalTerm_data ()
+{
+    QTest::addColumn<int>("dBm");
+    QTest::addColumn<QStringList>("expected");
+
+    // -100 dBm maps to 0% and -40 dBm to 100%, 1 dBm is 5/3%
+    QTest::newRow("no minimum") << int (NetworkSortFilter::NoMinimumSignal)
+                                << QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"};
+    QTest::newRow("-100 dBm") << -100
+                              << QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"};
+    QTest::newRow("-70 dBm is 50%") << -70
+                                    << QStringList {"Home", "Mystery", "Office"};
+    QTest::newRow("-71 dBm is 49%") << -71
+                                    << QStringList {"Home", "Mystery", "Office"};
+    QTest::newRow("-73 dBm is 45%") << -73
+                                    << QStringList {"Cafe", "Home", "Mystery", "Office"};
+    QTest::newRow("-52 dBm is 80%") << -52
+                                    << QStringList {"Home"};
+    QTest::newRow("-40 dBm is 100%") << -40
+                                     << QStringList();
+    QTest::newRow("above -40 dBm") << -20
+                                   << QStringList();
+}
+
+void NetworkSortTest::signalTerm ()
+{
+    QFETCH(int, dBm);
+    QFETCH(QStringList, expected);
+
+    filter->setMinimumSignal (dBm);
+    QCOMPARE (filter->minimumSignal(), dBm);
+    QCOMPARE (visibleNames (filter), expected);
+}
+
+
+void NetworkSortTest::ssidTerm_data ()
+{
+    QTest::addColumn<QString>("pattern");
+    QTest::addColumn<bool>("regularExpression");
+    QTest::addColumn<QStringList>("expected");
+
+    QTest::newRow("empty") << QString() << false
+                           << QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"};
+    QTest::newRow("substring") << QStringLiteral("o") << false
+                               << QStringList {"Home", "Office", "Old"};
+    QTest::newRow("substring ignores case") << QStringLiteral("HOME") << false
+                                            << QStringList {"Home"};
+    QTest::newRow("substring with space") << QStringLiteral("lab 6") << false
+                                          << QStringList {"Lab 6E"};
+    QTest::newRow("substring is literal") << QStringLiteral(".") << false
+                                          << QStringList();
+    QTest::newRow("expression") << QStringLiteral(".") << true
+                                << QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"};
+    QTest::newRow("expression anchored") << QStringLiteral("^o") << true
+                                         << QStringList {"Office", "Old"};
+    QTest::newRow("expression ignores case") << QStringLiteral("E$") << true
+                                             << QStringList {"Cafe", "Home", "Lab 6E", "Office"};
+    QTest::newRow("expression alternatives") << QStringLiteral("^(cafe|mys)") << true
+                                             << QStringList {"Cafe", "Mystery"};
+}
+
+void NetworkSortTest::ssidTerm ()
+{
+    QFETCH(QString, pattern);
+    QFETCH(bool, regularExpression);
+    QFETCH(QStringList, expected);
+
+    filter->setSsidFilter (pattern, regularExpression);
+    QCOMPARE (filter->ssidFilter(), pattern);
+    QCOMPARE (filter->ssidFilterIsRegularExpression(), regularExpression);
+    QCOMPARE (visibleNames (filter), expected);
+    QVERIFY (filter->filterError().isEmpty());
+}
+
+
+/* An invalid expression is reported and filters nothing */
+void NetworkSortTest::invalidExpression ()
+{
+    QSignalSpy errorSpy (filter, &NetworkSortFilter::filterErrorChanged);
+
+    filter->setSsidFilter (QStringLiteral("^o"), true);
+    QCOMPARE (visibleNames (filter), (QStringList {"Office", "Old"}));
+    QCOMPARE (errorSpy.count(), 0);
+
+    filter->setSsidFilter (QStringLiteral("(o"), true);
+    QVERIFY (!filter->filterError().isEmpty());
+    QCOMPARE (errorSpy.count(), 1);
+    QCOMPARE (errorSpy.at (0).at (0).toString(), filter->filterError());
+    QCOMPARE (visibleNames (filter), (QStringList {"Cafe", "Home", "Lab 6E", "Mystery", "Office", "Old"}));
+
+    // the same text is fine as a substring
+    filter->setSsidFilter (QStringLiteral("(o"), false);
+    QVERIFY (filter->filterError().isEmpty());
+    QCOMPARE (errorSpy.count(), 2);
+    QCOMPARE (visibleNames (filter), QStringList());
+}
+
+
+/* Networks have to match every active term */
+void NetworkSortTest::combinedTerms ()
+{
+    filter->setBandFilter (NetworkSortFilter::Band2GHz | NetworkSortFilter::Band5GHz);
+    filter->setMinimumSignal (-73);
+    QCOMPARE (visibleNames (filter), (QStringList {"Cafe", "Home", "Office"}));
+
+    filter->setSecurityFilter (NetworkSortFilter::OpenSecurity | NetworkSortFilter::EnterpriseSecurity);
+    QCOMPARE (visibleNames (filter), (QStringList {"Cafe", "Office"}));
+
+    filter->setSsidFilter (QStringLiteral("off"));
+    QCOMPARE (visibleNames (filter), QStringList {"Office"});
+
+    // dropping terms again
+    filter->setSecurityFilter (NetworkSortFilter::AllSecurity);
+    filter->setSsidFilter (QString());
+    QCOMPARE (visibleNames (filter), (QStringList {"Cafe", "Home", "Office"}));
+}
+
+
+/* Changing one term evaluates only that term again, the
+** results of the other terms are kept until a row changes
+*/
+void NetworkSortTest::termChangeKeepsOtherResults ()
+{
+    filter->setMinimumSignal (-70);
+    QCOMPARE (visibleNames (filter), (QStringList {"Home", "Mystery", "Office"}));
+
+    // changed without telling anybody, the cached signal result stays
+    itemAt (model, rowOf (model, QStringLiteral("Home")))->setSignalStrength (10);
+    itemAt (model, rowOf (model, QStringLiteral("Office")))->setName (QStringLiteral("Annex"));
+
+    filter->setSsidFilter (QStringLiteral("o"));
+    QCOMPARE (visibleNames (filter), QStringList {"Home"});
+
+    // the signal term is evaluated again once it changes itself
+    filter->setMinimumSignal (-71);
+    QCOMPARE (visibleNames (filter), QStringList());
+}
+
+
+/* A changed source row is evaluated again on every term */
+void NetworkSortTest::changedRowsEvaluatedAgain ()
+{
+    filter->setMinimumSignal (-70);
+    filter->setSsidFilter (QStringLiteral("o"));
+    QCOMPARE (visibleNames (filter), (QStringList {"Home", "Office"}));
+
+    const int row = rowOf (model, QStringLiteral("Home"));
+    itemAt (model, row)->setSignalStrength (10);
+    Q_EMIT model->dataChanged (model->index (row, 0), model->index (row, model->columnCount() - 1));
+    QCOMPARE (visibleNames (filter), QStringList {"Office"});
+
+    const int cafe = rowOf (model, QStringLiteral("Cafe"));
+    itemAt (model, cafe)->setName (QStringLiteral("Cafe Ole"));
+    itemAt (model, cafe)->setSignalStrength (90);
+    Q_EMIT model->dataChanged (model->index (cafe, 0), model->index (cafe, 0));
+    QCOMPARE (visibleNames (filter), (QStringList {"Cafe Ole", "Office"}));
+}
+
+
+/* Results of removed rows are dropped, a new row never picks
+** up the result of a removed one
+*/
+void NetworkSortTest::removedRowsForgotten ()
+{
+    filter->setSsidFilter (QStringLiteral("Home"));
+    QCOMPARE (visibleNames (filter), QStringList {"Home"});
+
+    // the new row likely reuses the memory of the removed item,
+    // it has no name yet so it must not be shown
+    const int row = rowOf (model, QStringLiteral("Home"));
+    QVERIFY (model->removeRows (row, 1));
+    QCOMPARE (filter->rowCount(), 0);
+    QVERIFY (model->insertRows (row, 1));
+    QCOMPARE (filter->rowCount(), 0);
+
+    itemAt (model, row)->setName (QStringLiteral("Home 2"));
+    Q_EMIT model->dataChanged (model->index (row, 0), model->index (row, 0));
+    QCOMPARE (visibleNames (filter), QStringList {"Home 2"});
+}
+
+
+QTEST_MAIN(NetworkSortTest)
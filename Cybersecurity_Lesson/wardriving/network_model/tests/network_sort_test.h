@@ -0,0 +1,39 @@
+#ifndef NetworkSortTest_H
+#define NetworkSortTest_H
+
+#include <QObject>
+
+class NetworkModel;
+class NetworkSortFilter;
+
+/* Filter terms of the network list, rows are inserted directly
+** so NetworkManager doesn't have to be running
+*/
+class NetworkSortTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void init ();
+    void cleanup ();
+
+    void securityTerm_data ();
+    void securityTerm ();
+    void bandTerm_data ();
+    void bandTerm ();
+    void signalTerm_data ();
+    void signalTerm ();
+    void ssidTerm_data ();
+    void ssidTerm ();
+    void invalidExpression ();
+    void combinedTerms ();
+    void termChangeKeepsOtherResults ();
+    void changedRowsEvaluatedAgain ();
+    void removedRowsForgotten ();
+
+private:
+    NetworkModel *model = nullptr;
+    NetworkSortFilter *filter = nullptr;
+};
+
+#endif // NetworkSortTest_H
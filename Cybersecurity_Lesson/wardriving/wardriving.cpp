@@ -8,6 +8,7 @@
 #include "custom_colors.h"
 
 #include "network_model.h"
+#include "network_sort.h"
 
 
 WarDriving::WarDriving(QWidget *parent) :
@@ -34,13 +35,22 @@ void WarDriving::setup_network_list (void)
 
     NetworkModel *network_model = new NetworkModel (roles);
 
+    // Filter shows every network until a filter term is set,
+    // sorting is passed through to the network model
+    network_filter = new NetworkSortFilter (this);
+    network_filter->setSourceModel (network_model);
+
     // Set network model and column settings
-    ui->network_list->setModel (network_model);
+    ui->network_list->setModel (network_filter);
     ui->network_list->resizeColumnToContents (network_model->columnCount()-1);
     ui->network_list->setIndentation (10);
     ui->network_list->setIconSize (QSize (36,36));
     ui->network_list->setColumnWidth (0, 290);
 
+    // Sort by network name, new networks are inserted in order
+    ui->network_list->setSortingEnabled (true);
+    ui->network_list->sortByColumn (0, Qt::AscendingOrder);
+
     // Set treeview header font
     ui->network_list->header()->setFont(QFont("LiberationSans", 18, QFont::Bold));
 
@@ -7,6 +7,8 @@
 /* local include files */
 #include "custom_stylesheets.h"
 
+class NetworkSortFilter;
+
 namespace Ui {
 class WarDriving;
 }
@@ -23,6 +25,7 @@ private:
     Ui::WarDriving *ui;
 
     CustomStyleSheets *stylesheets;
+    NetworkSortFilter *network_filter;
     QString treeview_stylesheet;
 
     void setup_network_list (void);